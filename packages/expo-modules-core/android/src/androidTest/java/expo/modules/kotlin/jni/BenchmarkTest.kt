@@ -1,5 +1,8 @@
 package expo.modules.kotlin.jni
 
+import android.os.Debug
+import com.facebook.react.bridge.ReadableMap
+import expo.modules.core.arguments.ReadableArguments
 import org.junit.Ignore
 import org.junit.Test
 import kotlin.time.Duration.Companion.nanoseconds
@@ -35,4 +38,106 @@ class BenchmarkTest {
     val avg = totalAvg / numberOfTries
     println("Average time for $numberOfTries tries: $avg")
   }
+
+  /**
+   * Measures converting an array of 10k objects, which creates a wrapper registered in the native handle table for each of them.
+   */
+  @Test
+  fun benchmarkObjectsArrayArgument() {
+    val numberOfTries = 10
+    var totalAvg = 0.nanoseconds
+    repeat(numberOfTries) {
+      withSingleModule({
+        Function("count") { objects: List<JavaScriptObject> ->
+          objects.size
+        }
+      }) {
+        evaluateScript("globalThis.objects = Array.from({ length: 10000 }, (_, i) => ({ i }))")
+        val numberOfCalls = 20
+        var total = 0.nanoseconds
+        repeat(numberOfCalls) {
+          val time = measureTime {
+            callVoid("count", "globalThis.objects")
+          }
+
+          total += time
+        }
+
+        val average = total / numberOfCalls
+        totalAvg += average
+        println("Average time: $average")
+      }
+    }
+    val avg = totalAvg / numberOfTries
+    println("Average time for $numberOfTries tries: $avg")
+  }
+
+  /**
+   * Measures returning values whose type isn't declared, so it's resolved from the class of the value.
+   */
+  @Test
+  fun benchmarkUntypedReturnValues() {
+    val values = listOf<Any>(1.5, 42, "string", true, 42L, 1.5f, listOf(1, 2), mapOf("key" to "value"))
+    val numberOfTries = 10
+    var totalAvg = 0.nanoseconds
+    repeat(numberOfTries) {
+      withSingleModule({
+        Function("getAny") { index: Int ->
+          values[index] as Any
+        }
+      }) {
+        val numberOfCalls = 10_000
+        var total = 0.nanoseconds
+        repeat(numberOfCalls) { index ->
+          val time = measureTime {
+            callVoid("getAny", "${index % values.size}")
+          }
+
+          total += time
+        }
+
+        val average = total / numberOfCalls
+        totalAvg += average
+        println("Average time: $average")
+      }
+    }
+    val avg = totalAvg / numberOfTries
+    println("Average time for $numberOfTries tries: $avg")
+  }
+
+  /**
+   * Compares converting a large object through folly::dynamic and `ReadableNativeMap` (the `ReadableMap` argument,
+   * converted to a `HashMap` like the `ReadableArguments` converter used to do) with the direct JSI-to-Java map conversion
+   * used by `ReadableArguments`. Prints the average time and the number of Java allocations per call.
+   */
+  @Suppress("DEPRECATION")
+  @Test
+  fun benchmarkMapArguments() {
+    withSingleModule({
+      Function("readableMap") { map: ReadableMap ->
+        map.toHashMap().size
+      }
+      Function("readableArguments") { args: ReadableArguments ->
+        args.size()
+      }
+    }) {
+      evaluateScript(
+        "globalThis.largeObject = Object.fromEntries(Array.from({ length: 1000 }, (_, i) => [`key${'$'}i`, { i, name: `item${'$'}i`, tags: ['a', 'b'] }]))"
+      )
+      listOf("readableMap", "readableArguments").forEach { functionName ->
+        val numberOfCalls = 200
+        var total = 0.nanoseconds
+        Debug.resetGlobalAllocCount()
+        Debug.startAllocCounting()
+        repeat(numberOfCalls) {
+          total += measureTime {
+            callVoid(functionName, "globalThis.largeObject")
+          }
+        }
+        Debug.stopAllocCounting()
+
+        println("$functionName: average time: ${total / numberOfCalls}, allocations per call: ${Debug.getGlobalAllocCount() / numberOfCalls}")
+      }
+    }
+  }
 }
@@ -1,9 +1,51 @@
 package expo.modules.kotlin.jni
 
 import com.google.common.truth.Truth
+import expo.modules.kotlin.events.EventDeliveryPolicy
+import expo.modules.kotlin.events.EventPayloadSchema
+import expo.modules.kotlin.events.KModuleEventEmitterWrapper
+import expo.modules.kotlin.exception.UnexpectedException
+import io.mockk.mockk
+import java.lang.ref.WeakReference
+import java.lang.reflect.InvocationTargetException
+import org.junit.Assert
 import org.junit.Test
 
 class EventEmitterTest {
+  private val valueSchema = EventPayloadSchema {
+    int("value")
+  }
+
+  private fun SingleTestContext.createEmitter(): KModuleEventEmitterWrapper {
+    val moduleHolder = requireNotNull(
+      jsiInterop.runtimeHolder.get()?.appContext?.registry?.getModuleHolder("TestModule")
+    )
+    return KModuleEventEmitterWrapper(moduleHolder, mockk(relaxed = true), WeakReference(null))
+  }
+
+  private fun SingleTestContext.getModuleObject(): JavaScriptModuleObject = requireNotNull(
+    jsiInterop.runtimeHolder.get()?.appContext?.registry?.getModuleHolder("TestModule")?.safeJSObject
+  )
+
+  private fun SingleTestContext.listenToValues() {
+    evaluateScript(
+      "values = []",
+      "$moduleRef.addListener('onValue', (payload) => { values.push(payload.value) })"
+    )
+  }
+
+  /**
+   * Emits the values within a single JS task, so they're all queued before the queue is drained.
+   */
+  private fun SingleTestContext.emitValuesInSingleTask(emitter: KModuleEventEmitterWrapper, vararg values: Int) {
+    jsiInterop.scheduleOnJSThread {
+      val payload = valueSchema.newPayload()
+      values.forEach { emitter.emit("onValue", payload.putInt("value", it)) }
+    }
+  }
+
+  private fun SingleTestContext.receivedValues() = evaluateScript("values.join()").getString()
+
   @Test
   fun event_emitter_class_should_exists() = withJSIInterop {
     val sharedObjectClass = evaluateScript("expo.EventEmitter")
@@ -21,4 +63,196 @@ class EventEmitterTest {
     )
     Truth.assertThat(emittersAreEqual.getBool()).isTrue()
   }
+
+  @Test
+  fun listeners_added_during_emission_should_be_called_from_next_emission() = withJSIInterop {
+    val calls = evaluateScript(
+      """
+      emitter = new expo.EventEmitter();
+      calls = [];
+      added = () => calls.push('added');
+      emitter.addListener('event', () => {
+        calls.push('first');
+        if (emitter.listenerCount('event') === 1) {
+          emitter.addListener('event', added);
+        }
+      });
+      emitter.emit('event');
+      emitter.emit('event');
+      calls.join();
+      """.trimIndent()
+    ).getString()
+    Truth.assertThat(calls).isEqualTo("first,first,added")
+  }
+
+  @Test
+  fun listeners_removed_during_emission_should_be_called_one_last_time() = withJSIInterop {
+    val calls = evaluateScript(
+      """
+      emitter = new expo.EventEmitter();
+      calls = [];
+      second = () => calls.push('second');
+      emitter.addListener('event', () => {
+        calls.push('first');
+        emitter.removeListener('event', second);
+      });
+      emitter.addListener('event', second);
+      emitter.emit('event');
+      emitter.emit('event');
+      calls.join() + '|' + emitter.listenerCount('event');
+      """.trimIndent()
+    ).getString()
+    Truth.assertThat(calls).isEqualTo("first,second,first|1")
+  }
+
+  @Test
+  fun all_listeners_removed_during_emission_should_be_cleared_after_it() = withJSIInterop {
+    val calls = evaluateScript(
+      """
+      emitter = new expo.EventEmitter();
+      calls = [];
+      emitter.addListener('event', () => {
+        calls.push('first');
+        emitter.removeAllListeners('event');
+        emitter.addListener('event', () => calls.push('added'));
+      });
+      emitter.addListener('event', () => calls.push('second'));
+      emitter.emit('event');
+      const countAfterFirstEmission = emitter.listenerCount('event');
+      emitter.emit('event');
+      calls.join() + '|' + countAfterFirstEmission;
+      """.trimIndent()
+    ).getString()
+    // The listener added after `removeAllListeners` survives it, the ones present before don't.
+    Truth.assertThat(calls).isEqualTo("first,second,added|1")
+  }
+
+  @Test
+  fun module_sends_events_with_binary_payloads() = withSingleModule({
+    Events("onLocation")
+  }) {
+    evaluateScript(
+      "payloads = []",
+      "$moduleRef.addListener('onLocation', (payload) => { payloads.push(payload) })"
+    )
+
+    val schema = EventPayloadSchema {
+      double("latitude")
+      int("count")
+      long("timestamp")
+      boolean("isMocked")
+    }
+    val moduleHolder = requireNotNull(
+      jsiInterop.runtimeHolder.get()?.appContext?.registry?.getModuleHolder("TestModule")
+    )
+    val emitter = KModuleEventEmitterWrapper(moduleHolder, mockk(relaxed = true), WeakReference(null))
+
+    val payload = schema.newPayload()
+      .putDouble("latitude", 52.5)
+      .putInt("count", -3)
+      .putLong("timestamp", 1_700_000_000_000L)
+      .putBoolean("isMocked", true)
+    emitter.emit("onLocation", payload)
+    // Payloads are copied when they're sent, so the same payload can be reused for the next event.
+    emitter.emit("onLocation", payload.putInt(schema.fieldIndex("count"), 7).putBoolean("isMocked", false))
+
+    Truth.assertThat(evaluateScript("payloads.length").getInt()).isEqualTo(2)
+    Truth.assertThat(evaluateScript("Object.keys(payloads[0]).join()").getString())
+      .isEqualTo("latitude,count,timestamp,isMocked")
+    Truth.assertThat(evaluateScript("payloads[0].latitude").getDouble()).isEqualTo(52.5)
+    Truth.assertThat(evaluateScript("payloads[0].count").getInt()).isEqualTo(-3)
+    Truth.assertThat(evaluateScript("payloads[0].timestamp").getDouble()).isEqualTo(1_700_000_000_000.0)
+    Truth.assertThat(evaluateScript("payloads[0].isMocked").getBool()).isTrue()
+    Truth.assertThat(evaluateScript("payloads[1].count").getInt()).isEqualTo(7)
+    Truth.assertThat(evaluateScript("payloads[1].isMocked").getBool()).isFalse()
+  }
+
+  @Test
+  fun all_policy_delivers_every_event() = withSingleModule({
+    Events("onValue")
+  }) {
+    listenToValues()
+
+    emitValuesInSingleTask(createEmitter(), 1, 2, 3)
+
+    Truth.assertThat(receivedValues()).isEqualTo("1,2,3")
+  }
+
+  @Test
+  fun latest_policy_delivers_only_the_latest_event() = withSingleModule({
+    Events("onValue")
+  }) {
+    listenToValues()
+    jsiInterop.setEventDeliveryPolicy("onValue", EventDeliveryPolicy.LATEST)
+
+    emitValuesInSingleTask(createEmitter(), 1, 2, 3)
+
+    Truth.assertThat(receivedValues()).isEqualTo("3")
+  }
+
+  @Test
+  fun module_policy_takes_precedence_over_global_policy() = withSingleModule({
+    Events("onValue")
+  }) {
+    listenToValues()
+    jsiInterop.setEventDeliveryPolicy("onValue", EventDeliveryPolicy.LATEST)
+    jsiInterop.setEventDeliveryPolicy(getModuleObject(), "onValue", EventDeliveryPolicy.ALL)
+
+    emitValuesInSingleTask(createEmitter(), 1, 2, 3)
+
+    Truth.assertThat(receivedValues()).isEqualTo("1,2,3")
+  }
+
+  @Test
+  fun sample_policy_delivers_trailing_event_after_interval() = withSingleModule({
+    Events("onValue")
+  }) {
+    listenToValues()
+    jsiInterop.setEventDeliveryPolicy(getModuleObject(), "onValue", EventDeliveryPolicy.SAMPLE, sampleIntervalMs = 100)
+    val emitter = createEmitter()
+    val payload = valueSchema.newPayload()
+
+    emitter.emit("onValue", payload.putInt("value", 1))
+    emitter.emit("onValue", payload.putInt("value", 2))
+    emitter.emit("onValue", payload.putInt("value", 3))
+
+    // The first event is delivered right away, the others are held back until the interval elapses.
+    Truth.assertThat(receivedValues()).isEqualTo("1")
+
+    // The trailing event is enqueued from the delayed tasks thread, which isn't attached to the JVM.
+    Thread.sleep(500)
+
+    Truth.assertThat(receivedValues()).isEqualTo("1,3")
+  }
+
+  @Test
+  fun invalid_delivery_policy_should_throw() = withJSIInterop {
+    Assert.assertThrows(UnexpectedException::class.java) {
+      setEventDeliveryPolicy("onValue", EventDeliveryPolicy.SAMPLE, sampleIntervalMs = -1)
+    }
+
+    val setRawPolicy = JSIContext::class.java.getDeclaredMethod(
+      "setEventDeliveryPolicy",
+      Int::class.java,
+      Int::class.java,
+      Long::class.java
+    ).apply { isAccessible = true }
+    val exception = Assert.assertThrows(InvocationTargetException::class.java) {
+      setRawPolicy.invoke(this, JNIUtils.getEventId("onValue"), 5, 0L)
+    }
+    Truth.assertThat(exception.cause).isInstanceOf(UnexpectedException::class.java)
+  }
+
+  @Test
+  fun invalid_event_payload_field_type_should_throw() = withJSIInterop {
+    Assert.assertThrows(UnexpectedException::class.java) {
+      JNIUtils.registerEventPayloadSchema(arrayOf("value"), intArrayOf(5))
+    }
+    Assert.assertThrows(UnexpectedException::class.java) {
+      JNIUtils.registerEventPayloadSchema(arrayOf("value"), intArrayOf(-1))
+    }
+    Assert.assertThrows(UnexpectedException::class.java) {
+      JNIUtils.registerEventPayloadSchema(arrayOf("a", "b"), intArrayOf(0))
+    }
+  }
 }
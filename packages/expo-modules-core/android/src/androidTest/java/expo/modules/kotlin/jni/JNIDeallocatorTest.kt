@@ -3,7 +3,9 @@
 package expo.modules.kotlin.jni
 
 import com.google.common.truth.Truth
+import expo.modules.kotlin.exception.UnexpectedException
 import kotlinx.coroutines.ExperimentalCoroutinesApi
+import org.junit.Assert
 import org.junit.Test
 
 class JNIDeallocatorTest {
@@ -19,4 +21,47 @@ class JNIDeallocatorTest {
 
     Truth.assertThat(deallocator.inspectMemory()).contains(moduleObject.getHybridDataForJNIDeallocator())
   }
+
+  @Test
+  fun converted_arguments_should_be_registered_in_handle_table() {
+    var objects: List<JavaScriptObject> = emptyList()
+    withJSIInterop(
+      inlineModule {
+        Name("TestModule")
+        Function("retain") { args: List<JavaScriptObject> ->
+          objects = args
+        }
+      }
+    ) {
+      evaluateScript("expo.modules.TestModule.retain(Array.from({ length: 1000 }, (_, i) => ({ i })))")
+
+      Truth.assertThat(objects).hasSize(1000)
+      Truth.assertThat(getJSIHandlesCount()).isAtLeast(1000)
+      Truth.assertThat(objects.all { it.isValid() }).isTrue()
+
+      val memory = runtimeHolder.get()!!.deallocator.inspectMemory()
+      Truth.assertThat(memory).containsNoneIn(objects.map { it.getHybridDataForJNIDeallocator() })
+    }
+    Truth.assertThat(objects.none { it.isValid() }).isTrue()
+  }
+
+  @Test
+  fun detached_objects_should_throw() {
+    var obj: JavaScriptObject? = null
+    withJSIInterop(
+      inlineModule {
+        Name("TestModule")
+        Function("retain") { arg: JavaScriptObject ->
+          obj = arg
+        }
+      }
+    ) {
+      evaluateScript("expo.modules.TestModule.retain({ i: 1 })")
+      Truth.assertThat(obj!!.getProperty("i").getDouble()).isEqualTo(1.0)
+    }
+    Truth.assertThat(obj!!.isValid()).isFalse()
+    Assert.assertThrows(UnexpectedException::class.java) {
+      obj!!.getProperty("i")
+    }
+  }
 }
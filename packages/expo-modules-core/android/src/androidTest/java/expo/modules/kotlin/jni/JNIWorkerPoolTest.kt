@@ -0,0 +1,45 @@
+package expo.modules.kotlin.jni
+
+import com.google.common.truth.Truth
+import expo.modules.kotlin.jni.tests.JNIWorkerPoolTester
+import org.junit.Test
+import java.lang.ref.WeakReference
+
+class JNIWorkerPoolTest {
+  @Test
+  fun run_attached_should_run_task_right_away_on_attached_thread() {
+    Truth.assertThat(JNIWorkerPoolTester.runAttachedOnAttachedThread()).isTrue()
+  }
+
+  @Test
+  fun run_attached_should_run_task_on_worker_from_detached_thread() {
+    Truth.assertThat(JNIWorkerPoolTester.runAttachedOnDetachedThread()).isTrue()
+  }
+
+  @Test
+  fun run_attached_should_rethrow_task_error_to_detached_thread() {
+    val message = JNIWorkerPoolTester.runFailingTaskOnDetachedThread("Task has failed")
+    Truth.assertThat(message).isEqualTo("Task has failed")
+  }
+
+  @Test
+  fun release_should_delete_global_reference_from_detached_thread() {
+    val weakObject = releaseNewObjectOnDetachedThread()
+
+    // The reference is deleted asynchronously on a worker, so the object is collected eventually.
+    repeat(100) {
+      if (weakObject.get() == null) {
+        return
+      }
+      Runtime.getRuntime().gc()
+      Thread.sleep(10)
+    }
+    Truth.assertWithMessage("Global reference wasn't deleted").that(weakObject.get()).isNull()
+  }
+
+  private fun releaseNewObjectOnDetachedThread(): WeakReference<Any> {
+    val obj = Any()
+    JNIWorkerPoolTester.releaseOnDetachedThread(obj)
+    return WeakReference(obj)
+  }
+}
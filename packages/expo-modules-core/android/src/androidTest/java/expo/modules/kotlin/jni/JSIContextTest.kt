@@ -32,6 +32,27 @@ class JSIContextTest {
     ).isEqualTo("function")
   }
 
+  @Test
+  fun modules_registered_after_installation_should_be_available() = withSingleModule({
+    Function("f") { 1 }
+  }) {
+    Truth.assertThat(evaluateScript("Object.keys(expo.modules)").getArray().map { it.getString() })
+      .contains("TestModule")
+    Truth.assertThat(evaluateScript("expo.modules.LateModule").isUndefined()).isTrue()
+
+    val registry = requireNotNull(jsiInterop.runtimeHolder.get()?.appContext?.registry)
+    registry.register(
+      inlineModule {
+        Name("LateModule")
+        Function("f") { 2 }
+      },
+      null
+    )
+
+    Truth.assertThat(evaluateScript("expo.modules.LateModule.f()").getInt()).isEqualTo(2)
+    Truth.assertThat(call("f").getInt()).isEqualTo(1)
+  }
+
   @Test
   fun sync_functions_should_be_callable() = withSingleModule({
     Function("f1") { return@Function 20 }
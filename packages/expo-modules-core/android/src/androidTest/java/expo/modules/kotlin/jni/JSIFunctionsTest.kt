@@ -1,6 +1,7 @@
 package expo.modules.kotlin.jni
 
 import com.google.common.truth.Truth
+import expo.modules.core.arguments.ReadableArguments
 import expo.modules.kotlin.runtime.Runtime
 import expo.modules.kotlin.exception.CodedException
 import expo.modules.kotlin.exception.JavaScriptEvaluateException
@@ -28,6 +29,11 @@ class JSIFunctionsTest {
     K2("V2")
   }
 
+  enum class EmojiEnumClass(val value: String) : Enumerable {
+    SMILE("\uD83D\uDE00"),
+    SMILE_WITH_TEXT("smile \uD83D\uDE00")
+  }
+
   enum class IntEnumClass(val value: Int) : Enumerable {
     K1(1),
     K2(2)
@@ -57,6 +63,90 @@ class JSIFunctionsTest {
     Truth.assertThat(longValue).isEqualTo(21474836470)
   }
 
+  @Test
+  fun primitive_arguments_should_be_converted_by_non_trivial_converters() = withSingleModule({
+    Function("mixedF") { a: Int, b: Boolean, c: Double -> if (b) a + c else c - a }
+    Function("durationF") { a: Int, b: kotlin.time.Duration -> a * b.inWholeMilliseconds }
+  }) {
+    val mixedValue = call("mixedF", "2, false, 5.5").getDouble()
+    val durationValue = call("durationF", "3, 1.5").getDouble().toLong()
+
+    Truth.assertThat(mixedValue).isEqualTo(3.5)
+    Truth.assertThat(durationValue).isEqualTo(4500)
+  }
+
+  @Test
+  fun nested_null_and_undefined_should_be_converted_to_null() = withSingleModule({
+    Function("anyF") { a: Any ->
+      val map = a as Map<*, *>
+      val list = map["list"] as List<*>
+      listOf(map.containsKey("nullValue"), map["nullValue"] == null, list.size, list[0] == null, list[1] == null)
+    }
+  }) {
+    val value = call("anyF", "{ nullValue: null, list: [null, undefined] }").getArray()
+
+    Truth.assertThat(value[0].getBool()).isTrue()
+    Truth.assertThat(value[1].getBool()).isTrue()
+    Truth.assertThat(value[2].getInt()).isEqualTo(2)
+    Truth.assertThat(value[3].getBool()).isTrue()
+    Truth.assertThat(value[4].getBool()).isTrue()
+  }
+
+  @Test
+  fun lazy_functions_should_be_defined_once() = withSingleModule({
+    Function("f1") { 1 }
+    Function("f2") { 2 }
+  }) {
+    val value = evaluateScript(
+      "const first = $moduleRef.f1",
+      "[first === $moduleRef.f1, first(), Object.keys($moduleRef).includes('f2'), $moduleRef.f2()]"
+    ).getArray()
+
+    Truth.assertThat(value[0].getBool()).isTrue()
+    Truth.assertThat(value[1].getInt()).isEqualTo(1)
+    Truth.assertThat(value[2].getBool()).isTrue()
+    Truth.assertThat(value[3].getInt()).isEqualTo(2)
+  }
+
+  @Test
+  fun lazy_functions_should_shadow_inherited_properties() = withSingleModule({
+    Function("toString") { "module" }
+  }) {
+    Truth.assertThat(call("toString").getString()).isEqualTo("module")
+  }
+
+  @Test
+  fun classes_should_take_precedence_over_functions_with_the_same_name() = withSingleModule({
+    Function("Shape") { 1 }
+    Class("Shape") {
+      Function("area") { 2 }
+    }
+  }) {
+    val area = evaluateScript("new $moduleRef.Shape().area()").getInt()
+    val keys = evaluateScript("Object.keys($moduleRef)").getArray().map { it.getString() }
+    val areaAfterKeys = evaluateScript("new $moduleRef.Shape().area()").getInt()
+
+    Truth.assertThat(area).isEqualTo(2)
+    Truth.assertThat(keys).contains("Shape")
+    Truth.assertThat(areaAfterKeys).isEqualTo(2)
+  }
+
+  @Test
+  fun readable_arguments_should_be_converted_from_object() = withSingleModule({
+    Function("argsF") { args: ReadableArguments ->
+      val nested = args.getMap("nested")
+      listOf(args.getString("name"), args.getDouble("count"), args.getBoolean("flag"), nested["key"], args.getList("list").size)
+    }
+  }) {
+    val value = call("argsF", "{ name: 'expo', count: 2, flag: true, nested: { key: 'value' }, list: [1, 2, 3] }").getArray()
+
+    Truth.assertThat(value[0].getString()).isEqualTo("expo")
+    Truth.assertThat(value[1].getDouble()).isEqualTo(2.0)
+    Truth.assertThat(value[2].getBool()).isTrue()
+    Truth.assertThat(value[3].getString()).isEqualTo("value")
+    Truth.assertThat(value[4].getInt()).isEqualTo(3)
+  }
+
   @Test
   fun simple_list_should_be_convertible() = withSingleModule({
     Function("listF") { a: List<String> -> a }
@@ -201,6 +291,44 @@ class JSIFunctionsTest {
     }
   }
 
+  @Test
+  fun strings_with_surrogate_pairs_should_round_trip() {
+    val received = mutableListOf<String>()
+    val receivedEnums = mutableListOf<EmojiEnumClass>()
+
+    withSingleModule({
+      Function("stringF") { value: String ->
+        received.add(value)
+        value
+      }
+
+      Function("enumF") { value: EmojiEnumClass ->
+        receivedEnums.add(value)
+        value
+      }
+    }) {
+      // Strings go through `newJString` on the way to Kotlin and `readJString` with `createFromUtf16` on the way back.
+      Truth.assertThat(call("stringF", "'\\uD83D\\uDE00'").getString()).isEqualTo("\uD83D\uDE00")
+      Truth.assertThat(evaluateScript("$moduleRef.stringF('a\\uD83D\\uDE00b') === 'a\\uD83D\\uDE00b'").getBool()).isTrue()
+      Truth.assertThat(evaluateScript("$moduleRef.stringF('\\uD83D\\uDE00').codePointAt(0)").getInt()).isEqualTo(0x1F600)
+
+      // Enum values are short, so they're obtained from the intern cache. The second call gets the cached string.
+      repeat(2) {
+        Truth.assertThat(evaluateScript("$moduleRef.enumF('\\uD83D\\uDE00') === '\\uD83D\\uDE00'").getBool()).isTrue()
+      }
+      Truth.assertThat(evaluateScript("$moduleRef.enumF('smile \\uD83D\\uDE00') === 'smile \\uD83D\\uDE00'").getBool()).isTrue()
+    }
+
+    Truth.assertThat(received).containsExactly("\uD83D\uDE00", "a\uD83D\uDE00b", "\uD83D\uDE00").inOrder()
+    Truth.assertThat(received.first().codePointAt(0)).isEqualTo(0x1F600)
+    Truth.assertThat(received.first()).hasLength(2)
+    Truth.assertThat(receivedEnums).containsExactly(
+      EmojiEnumClass.SMILE,
+      EmojiEnumClass.SMILE,
+      EmojiEnumClass.SMILE_WITH_TEXT
+    ).inOrder()
+  }
+
   @Test
   fun records_should_be_obtainable_as_function_argument() {
     @OptimizedRecord
@@ -615,4 +743,25 @@ class JSIFunctionsTest {
     val value = call("getRef", "global.ref").getInt()
     Truth.assertThat(value).isEqualTo(123)
   }
+
+  @Test
+  fun sync_calls_should_reuse_args_array() = withSingleModule({
+    Function("concat") { a: String, b: String -> a + b }
+    Function("optional") { a: String, b: String? -> a + (b ?: "") }
+  }) {
+    repeat(3) { call("concat", "'a', 'b'") }
+    // Calls without the optional arguments need arrays of a different size.
+    repeat(2) { call("optional", "'a'") }
+
+    val moduleObject = requireNotNull(
+      jsiInterop.runtimeHolder.get()?.appContext?.registry?.getModuleHolder("TestModule")?.safeJSObject
+    )
+    Truth.assertThat(moduleObject.getFunctionCallStats("concat")).isEqualTo(
+      JavaScriptModuleObject.FunctionCallStats(calls = 3, primitiveCalls = 0, reusedArgsArrays = 2, allocatedArgsArrays = 1)
+    )
+    Truth.assertThat(moduleObject.getFunctionCallStats("optional")).isEqualTo(
+      JavaScriptModuleObject.FunctionCallStats(calls = 2, primitiveCalls = 0, reusedArgsArrays = 0, allocatedArgsArrays = 2)
+    )
+    Truth.assertThat(moduleObject.getFunctionCallStats("unknown")).isNull()
+  }
 }
@@ -60,6 +60,57 @@ class JavaScriptClassTest {
     Truth.assertThat(foo).isEqualTo("bar")
   }
 
+  @Test
+  fun classes_from_the_same_runtime_should_be_independent() {
+    val calledConstructors = mutableListOf<String>()
+    withSingleModule({
+      Class("FirstClass") {
+        Constructor {
+          calledConstructors.add("FirstClass")
+        }
+      }
+      Class("SecondClass") {
+        Constructor {
+          calledConstructors.add("SecondClass")
+        }
+      }
+    }) {
+      val names = evaluateScript("[$moduleRef.FirstClass.name, $moduleRef.SecondClass.name]")
+        .getArray()
+        .map { it.getString() }
+      Truth.assertThat(names).containsExactly("FirstClass", "SecondClass").inOrder()
+
+      val areIndependent = evaluateScript(
+        "first = new $moduleRef.FirstClass()",
+        "second = new $moduleRef.SecondClass()",
+        "$moduleRef.FirstClass.prototype !== $moduleRef.SecondClass.prototype",
+        "  && first instanceof $moduleRef.FirstClass && !(first instanceof $moduleRef.SecondClass)",
+        "  && second instanceof $moduleRef.SecondClass && !(second instanceof $moduleRef.FirstClass)"
+      ).getBool()
+      Truth.assertThat(areIndependent).isTrue()
+      Truth.assertThat(calledConstructors).containsExactly("FirstClass", "SecondClass").inOrder()
+    }
+  }
+
+  @Test
+  fun classes_should_be_created_in_every_runtime() {
+    var constructorCalls = 0
+    // Each runtime compiles its own class factory, so classes keep working after the previous runtime is gone.
+    withSingleModule({
+      Class("MyClass") {
+        Constructor {
+          constructorCalls++
+        }
+      }
+    }, numberOfReloads = 10) {
+      val isInstance = evaluateScript(
+        "$moduleRef.MyClass.name === 'MyClass' && new $moduleRef.MyClass() instanceof $moduleRef.MyClass"
+      ).getBool()
+      Truth.assertThat(isInstance).isTrue()
+    }
+    Truth.assertThat(constructorCalls).isEqualTo(10)
+  }
+
   @Test
   fun native_constructor_should_be_called() {
     var wasCalled = false
@@ -0,0 +1,54 @@
+package expo.modules.kotlin.jni
+
+import com.google.common.truth.Truth
+import expo.modules.kotlin.jni.tests.PromiseSettlementQueueTester
+import expo.modules.kotlin.jni.tests.RuntimeHolder
+import org.junit.Assert
+import org.junit.Test
+
+class PromiseSettlementQueueTest {
+  private inline fun withQueue(block: PromiseSettlementQueueTester.(runtimePointer: Long) -> Unit) {
+    RuntimeHolder().use { runtimeHolder ->
+      val runtimePointer = runtimeHolder.createRuntime()
+      PromiseSettlementQueueTester().block(runtimePointer)
+    }
+  }
+
+  @Test
+  fun settlements_should_be_run_in_a_single_drain_in_order() = withQueue { runtimePointer ->
+    enqueue(1, shouldThrow = false)
+    enqueue(2, shouldThrow = false)
+    enqueue(3, shouldThrow = false)
+
+    Truth.assertThat(runScheduledDrains(runtimePointer)).isEqualTo(1)
+    Truth.assertThat(getSettledIds().toList()).containsExactly(1, 2, 3).inOrder()
+  }
+
+  @Test
+  fun settlements_enqueued_after_drain_should_schedule_next_drain() = withQueue { runtimePointer ->
+    enqueue(1, shouldThrow = false)
+    Truth.assertThat(runScheduledDrains(runtimePointer)).isEqualTo(1)
+
+    enqueue(2, shouldThrow = false)
+    Truth.assertThat(runScheduledDrains(runtimePointer)).isEqualTo(1)
+    Truth.assertThat(getSettledIds().toList()).containsExactly(1, 2).inOrder()
+  }
+
+  @Test
+  fun failing_settlements_should_not_stop_the_batch() = withQueue { runtimePointer ->
+    enqueue(1, shouldThrow = true)
+    enqueue(2, shouldThrow = false)
+    enqueue(3, shouldThrow = true)
+
+    val exception = Assert.assertThrows(RuntimeException::class.java) {
+      runScheduledDrains(runtimePointer)
+    }
+
+    Truth.assertThat(exception.message).contains("Settlement 1 has failed")
+    Truth.assertThat(getSettledIds().toList()).containsExactly(1, 2, 3).inOrder()
+
+    enqueue(4, shouldThrow = false)
+    Truth.assertThat(runScheduledDrains(runtimePointer)).isEqualTo(1)
+    Truth.assertThat(getSettledIds().toList()).containsExactly(1, 2, 3, 4).inOrder()
+  }
+}
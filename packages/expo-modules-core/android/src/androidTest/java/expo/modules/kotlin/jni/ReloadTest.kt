@@ -46,4 +46,26 @@ class ReloadTest {
       Truth.assertThat(native).isSameInstanceAs(mySharedObject)
     }
   }
+
+  @Test
+  fun should_resolve_context_of_new_runtime_after_reload() {
+    var retainedObject: JavaScriptObject? = null
+
+    // Runtimes are created and torn down on the same thread, so a lookup cached on that thread
+    // must not return the context of the previous runtime, even if the new one reuses its address.
+    withSingleModule({
+      Function("retain") { jsObject: JavaScriptObject ->
+        retainedObject = jsObject
+      }
+    }, numberOfReloads = 100) {
+      // The object retained from the previous runtime was detached when that runtime was torn down.
+      Truth.assertThat(retainedObject?.isValid() ?: false).isFalse()
+
+      val handlesCount = jsiInterop.getJSIHandlesCount()
+      call("retain", "{}")
+
+      Truth.assertThat(retainedObject!!.isValid()).isTrue()
+      Truth.assertThat(jsiInterop.getJSIHandlesCount()).isEqualTo(handlesCount + 1)
+    }
+  }
 }
@@ -4,10 +4,13 @@ package expo.modules.kotlin.jni
 
 import com.google.common.truth.Truth
 import expo.modules.kotlin.exception.CodedException
+import expo.modules.kotlin.exception.InvalidSharedObjectIdException
+import expo.modules.kotlin.exception.UsingReleasedSharedObjectException
 import expo.modules.kotlin.sharedobjects.SharedObject
 import expo.modules.kotlin.sharedobjects.SharedObjectId
 import expo.modules.kotlin.sharedobjects.sharedObjectIdPropertyName
 import kotlinx.coroutines.ExperimentalCoroutinesApi
+import org.junit.Assert
 import org.junit.Test
 
 class SharedObjectTest {
@@ -63,6 +66,59 @@ class SharedObjectTest {
     Truth.assertThat(containSharedObject).isTrue()
   }
 
+  @Test
+  fun should_reuse_ids_of_released_objects_with_new_generation() = withExampleSharedClass {
+    val releasedId = evaluateScript(
+      "released = new $moduleRef.SharedObjectExampleClass()",
+      "released.$sharedObjectIdPropertyName"
+    ).getInt()
+    evaluateScript("released.release()")
+
+    val newId = evaluateScript(
+      "new $moduleRef.SharedObjectExampleClass().$sharedObjectIdPropertyName"
+    ).getInt()
+
+    // The lower 22 bits hold the slot index, the upper ones its generation.
+    val slotMask = (1 shl 22) - 1
+    Truth.assertThat(newId and slotMask).isEqualTo(releasedId and slotMask)
+    Truth.assertThat(newId).isNotEqualTo(releasedId)
+    Truth.assertThat(jsiInterop.wasSharedObjectReleased(releasedId)).isTrue()
+    Truth.assertThat(jsiInterop.wasSharedObjectReleased(newId)).isFalse()
+  }
+
+  @Test
+  fun should_detect_stale_ids() = withExampleSharedClass {
+    val releasedId = evaluateScript(
+      "released = new $moduleRef.SharedObjectExampleClass()",
+      "released.$sharedObjectIdPropertyName"
+    ).getInt()
+    evaluateScript("released.release()")
+    evaluateScript("new $moduleRef.SharedObjectExampleClass()")
+
+    val registry = jsiInterop.runtimeHolder.get()!!.sharedObjectRegistry
+    Assert.assertThrows(UsingReleasedSharedObjectException::class.java) {
+      registry.toNativeObject(SharedObjectId(releasedId))
+    }
+    Assert.assertThrows(InvalidSharedObjectIdException::class.java) {
+      registry.toNativeObject(SharedObjectId(Int.MAX_VALUE))
+    }
+  }
+
+  @Test
+  fun should_count_live_and_peak_objects() = withExampleSharedClass {
+    val initialLiveCount = jsiInterop.getLiveSharedObjectsCount()
+
+    evaluateScript(
+      "objects = [0, 1, 2].map(() => new $moduleRef.SharedObjectExampleClass())"
+    )
+    Truth.assertThat(jsiInterop.getLiveSharedObjectsCount()).isEqualTo(initialLiveCount + 3)
+    Truth.assertThat(jsiInterop.getPeakSharedObjectsCount()).isAtLeast(initialLiveCount + 3)
+
+    evaluateScript("objects[0].release()", "objects[1].release()")
+    Truth.assertThat(jsiInterop.getLiveSharedObjectsCount()).isEqualTo(initialLiveCount + 1)
+    Truth.assertThat(jsiInterop.getPeakSharedObjectsCount()).isAtLeast(initialLiveCount + 3)
+  }
+
   @Test
   fun is_instance_of() = withExampleSharedClass {
     val isInstanceOf = evaluateScript(
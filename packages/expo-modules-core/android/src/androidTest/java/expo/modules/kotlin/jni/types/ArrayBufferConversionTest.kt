@@ -5,6 +5,7 @@ package expo.modules.kotlin.jni.types
 import com.facebook.react.bridge.ReactApplicationContext
 import com.google.common.truth.Truth
 import expo.modules.kotlin.exception.CodedException
+import expo.modules.kotlin.exception.JavaScriptEvaluateException
 import expo.modules.kotlin.functions.Coroutine
 import expo.modules.kotlin.jni.ArrayBuffer
 import expo.modules.kotlin.jni.ControllableJSHeapAccessExecutor
@@ -747,6 +748,25 @@ class ArrayBufferConversionTest {
     Truth.assertThat(copiedBuffer.readByte(0)).isEqualTo(0x42.toByte())
   }
 
+  @Test
+  fun array_buffer_args_of_different_kinds_should_be_converted_in_one_call() = withJSIInterop(
+    inlineModule {
+      Name("TestModule")
+      Function("byteLengths") { typedArray: ArrayBuffer, dataView: ArrayBuffer, buffer: ArrayBuffer, nothing: ArrayBuffer?, count: Int ->
+        listOf(typedArray.size(), dataView.size(), buffer.size(), nothing?.size() ?: -1, count)
+      }
+    }
+  ) {
+    val result = evaluateScript(
+      """
+        const buffer = new ArrayBuffer(8);
+        expo.modules.TestModule.byteLengths(new Float32Array(buffer, 4, 1), new DataView(buffer, 2), buffer, null, 5)
+      """.trimIndent()
+    ).getArray()
+
+    Truth.assertThat(result.map { it.getInt() }).containsExactly(4, 6, 8, -1, 5).inOrder()
+  }
+
   @Test
   fun array_buffer_arg_should_share_native_backed_array_buffer() = withJSIInterop(
     nativeBackedArrayBufferModule()
@@ -1013,6 +1033,145 @@ class ArrayBufferConversionTest {
     Truth.assertThat(result[1].getArray().map { it.getInt() }).containsExactly(0x42, 0x42, 0x42, 0x42).inOrder()
   }
 
+  @Test
+  fun array_buffer_copy_to_reads_js_backed_range_with_js_heap_executor() {
+    ControllableJSHeapAccessExecutor.sameThread().use { executor ->
+      withJSIInterop(nativeBackedArrayBufferModule(), jsHeapAccessExecutor = executor) {
+        val result = evaluateScript(
+          """
+            const buffer = new Uint8Array([1, 2, 3, 4, 5]).buffer;
+            [
+              expo.modules.TestModule.copyRange(buffer, 1, 3),
+              expo.modules.TestModule.isArrayBufferNativeBacked(buffer)
+            ];
+          """.trimIndent()
+        ).getArray()
+
+        Truth.assertThat(result[0].getArray().map { it.getInt() }).containsExactly(2, 3, 4).inOrder()
+        Truth.assertThat(result[1].getBool()).isFalse()
+      }
+    }
+  }
+
+  @Test(expected = JavaScriptEvaluateException::class)
+  fun array_buffer_copy_to_rejects_out_of_bounds_range() = withJSIInterop(
+    nativeBackedArrayBufferModule()
+  ) {
+    evaluateScript("expo.modules.TestModule.copyRange(new Uint8Array([1, 2]).buffer, 1, 2)")
+  }
+
+  @Test
+  fun array_buffer_copy_to_async_reads_typed_array_view_range() = withJSIInterop(
+    nativeBackedArrayBufferModule()
+  ) { methodQueue ->
+    val result = waitForAsyncFunction(
+      methodQueue,
+      """
+        (() => {
+          const buffer = new Uint8Array([1, 2, 3, 4, 5]).buffer;
+          return expo.modules.TestModule.copyRangeAsync(new Uint8Array(buffer, 1, 4), 2, 2);
+        })()
+      """.trimIndent()
+    ).getArray()
+
+    Truth.assertThat(result.map { it.getInt() }).containsExactly(4, 5).inOrder()
+  }
+
+  @Test
+  fun pooled_array_buffer_should_be_returned() = withJSIInterop(
+    nativeBackedArrayBufferModule()
+  ) {
+    val result = evaluateScript(
+      """
+        const buffer = expo.modules.TestModule.createPooledArrayBuffer(3, 7);
+        [Array.from(new Uint8Array(buffer)), expo.modules.TestModule.isArrayBufferNativeBacked(buffer)];
+      """.trimIndent()
+    ).getArray()
+
+    Truth.assertThat(result[0].getArray().map { it.getInt() }).containsExactly(7, 0, 0).inOrder()
+    Truth.assertThat(result[1].getBool()).isTrue()
+  }
+
+  @Test
+  fun recycled_pooled_array_buffer_is_invalid() {
+    val buffer = ArrayBuffer.allocatePooled(16)
+    Truth.assertThat(buffer.size()).isEqualTo(16)
+
+    buffer.recycle()
+
+    Truth.assertThat(buffer.isValid()).isFalse()
+  }
+
+  @Test
+  fun pooled_array_buffer_reuses_memory_of_recycled_buffer() {
+    val first = ArrayBuffer.allocatePooled(4096)
+    first.withMutableJSBytes { scopedBuffer ->
+      scopedBuffer.put(0, 7.toByte())
+    }
+    first.recycle()
+    val statsBefore = ArrayBuffer.getPoolStats()
+
+    val second = ArrayBuffer.allocatePooled(4000)
+
+    val statsAfter = ArrayBuffer.getPoolStats()
+    Truth.assertThat(statsAfter.hits).isEqualTo(statsBefore.hits + 1)
+    Truth.assertThat(statsAfter.misses).isEqualTo(statsBefore.misses)
+    Truth.assertThat(statsAfter.pooledBytes).isEqualTo(statsBefore.pooledBytes - 4096)
+    // The reused memory is cleared.
+    Truth.assertThat(second.readByte(0)).isEqualTo(0.toByte())
+    second.recycle()
+  }
+
+  @Test
+  fun returned_byte_array_should_use_pooled_memory() = withJSIInterop(
+    nativeBackedArrayBufferModule()
+  ) {
+    val allocationsBefore = ArrayBuffer.getPoolStats().run { hits + misses }
+    val result = evaluateScript(
+      """
+        const bytes = expo.modules.TestModule.createByteArray(5000);
+        [bytes.length, bytes[0], bytes[4999], expo.modules.TestModule.isArrayBufferNativeBacked(bytes.buffer)];
+      """.trimIndent()
+    ).getArray()
+
+    Truth.assertThat(result[0].getInt()).isEqualTo(5000)
+    Truth.assertThat(result[1].getInt()).isEqualTo(1)
+    Truth.assertThat(result[2].getInt()).isEqualTo(1)
+    Truth.assertThat(result[3].getBool()).isTrue()
+    val allocationsAfter = ArrayBuffer.getPoolStats().run { hits + misses }
+    Truth.assertThat(allocationsAfter).isGreaterThan(allocationsBefore)
+  }
+
+  @Test
+  fun pooled_native_array_buffer_should_be_returned() = withJSIInterop(
+    nativeBackedArrayBufferModule()
+  ) {
+    val result = evaluateScript(
+      """
+        const buffer = expo.modules.TestModule.createPooledNative(3, 7);
+        Array.from(new Uint8Array(buffer));
+      """.trimIndent()
+    ).getArray()
+
+    Truth.assertThat(result.map { it.getInt() }).containsExactly(7, 0, 0).inOrder()
+  }
+
+  @Test
+  fun pooled_native_array_buffer_reuses_memory_of_recycled_buffer() {
+    val first = NativeArrayBuffer.allocatePooled(4096)
+    first.toDirectBuffer().put(0, 7.toByte())
+    first.recycle()
+    Truth.assertThat(first.isValid()).isFalse()
+    val hitsBefore = ArrayBuffer.getPoolStats().hits
+
+    val second = NativeArrayBuffer.allocatePooled(4000)
+
+    Truth.assertThat(ArrayBuffer.getPoolStats().hits).isEqualTo(hitsBefore + 1)
+    Truth.assertThat(second.size()).isEqualTo(4000)
+    Truth.assertThat(second.readByte(0)).isEqualTo(0.toByte())
+    second.recycle()
+  }
+
   @Test
   fun array_buffer_returning_empty_js_buffer_preserves_identity_with_js_heap_executor() {
     ControllableJSHeapAccessExecutor.sameThread().use { executor ->
@@ -1143,6 +1302,32 @@ class ArrayBufferConversionTest {
     jsAssertion = {}
   )
 
+  @Test
+  fun js_array_buffer_shares_partial_typed_array_view_bytes() = withJSIInterop(
+    inlineModule {
+      Name("TestModule")
+      Function("fill") { arrayBuffer: JavaScriptArrayBuffer ->
+        arrayBuffer.toDirectBuffer().apply {
+          while (hasRemaining()) {
+            put(0x42.toByte())
+          }
+        }
+        arrayBuffer
+      }
+    }
+  ) {
+    val result = evaluateScript(
+      """
+        const source = new Uint8Array([1, 2, 3, 4, 5]);
+        const returnedBuffer = expo.modules.TestModule.fill(new Uint8Array(source.buffer, 1, 2));
+        [Array.from(source), Array.from(new Uint8Array(returnedBuffer))]
+      """.trimIndent()
+    ).getArray()
+
+    Truth.assertThat(result[0].getArray().map { it.getInt() }).containsExactly(1, 0x42, 0x42, 4, 5).inOrder()
+    Truth.assertThat(result[1].getArray().map { it.getInt() }).containsExactly(0x42, 0x42).inOrder()
+  }
+
   @Test
   fun native_array_buffer_accepts_partial_typed_array_view() = conversionTest<NativeArrayBuffer, _>(
     jsValue = "new Uint8Array(new Uint8Array([1,2,3,4,5]).buffer, 1, 2)",
@@ -1355,6 +1540,24 @@ class ArrayBufferConversionTest {
       ArrayBuffer.allocate(size)
     }
 
+    Function("createByteArray") { size: Int ->
+      ByteArray(size) { 1 }
+    }
+
+    Function("createPooledNative") { size: Int, value: Int ->
+      NativeArrayBuffer.allocatePooled(size).apply {
+        toDirectBuffer().put(0, value.toByte())
+      }
+    }
+
+    Function("createPooledArrayBuffer") { size: Int, value: Int ->
+      ArrayBuffer.allocatePooled(size).apply {
+        withMutableJSBytes { scopedBuffer ->
+          scopedBuffer.put(0, value.toByte())
+        }
+      }
+    }
+
     Function("fillNativeBuffer") { buffer: NativeArrayBuffer, value: Int ->
       buffer.toDirectBuffer().apply {
         rewind()
@@ -1431,6 +1634,20 @@ class ArrayBufferConversionTest {
       }
     }
 
+    Function("copyRange") { buffer: ArrayBuffer, position: Int, count: Int ->
+      val destination = ByteBuffer.allocateDirect(count)
+      buffer.copyTo(destination, position)
+      destination.flip()
+      List(destination.remaining()) { destination.get().toInt() and 0xff }
+    }
+
+    AsyncFunction("copyRangeAsync") Coroutine { buffer: ArrayBuffer, position: Int, count: Int ->
+      val destination = ByteBuffer.allocateDirect(count)
+      buffer.copyToAsync(destination, position)
+      destination.flip()
+      List(destination.remaining()) { destination.get().toInt() and 0xff }
+    }
+
     AsyncFunction("readWithJSBytesAsync") Coroutine { buffer: ArrayBuffer, count: Int ->
       buffer.withJSBytesAsync { scopedBuffer ->
         scopedBuffer.rewind()
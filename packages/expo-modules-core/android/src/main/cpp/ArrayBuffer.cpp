@@ -3,9 +3,12 @@
 #include "Exceptions.h"
 #include "JavaReferencesCache.h"
 #include "JavaScriptRuntime.h"
+#include "JNIWorkerPool.h"
 #include "JSIContext.h"
+#include "MemoryBuffer.h"
 
 #include <atomic>
+#include <cstring>
 #include <limits>
 
 namespace expo {
@@ -42,6 +45,17 @@ jni::local_ref<jni::JByteBuffer> copyToDirectBuffer(uint8_t *data, size_t length
   return byteBuffer;
 }
 
+/**
+ * Copies the given bytes into a buffer from the shared `MemoryBufferPool`, for ArrayBuffers created for JavaScript.
+ */
+std::shared_ptr<jsi::MutableBuffer> copyToMemoryBuffer(const uint8_t *data, size_t length) {
+  auto buffer = MemoryBuffer::allocate(length);
+  if (length > 0) {
+    memcpy(buffer->data(), data, length);
+  }
+  return buffer;
+}
+
 jni::local_ref<jni::JObject> invokeBodyWithByteBuffer(
   jni::alias_ref<JNIFunctionBody::javaobject> body,
   jni::local_ref<jni::JByteBuffer> byteBuffer
@@ -105,7 +119,7 @@ public:
   }
 
   ~ByteBufferJSIMutableBuffer() override {
-    jni::ThreadScope::WithClassLoader([&] { _byteBuffer.reset(); });
+    JNIWorkerPool::shared().release(std::move(_byteBuffer));
   }
 
   uint8_t *data() override {
@@ -256,7 +270,7 @@ ByteBufferArrayBufferStorage::ByteBufferArrayBufferStorage(const jni::alias_ref<
 }
 
 ByteBufferArrayBufferStorage::~ByteBufferArrayBufferStorage() {
-  jni::ThreadScope::WithClassLoader([&] { _byteBuffer.reset(); });
+  JNIWorkerPool::shared().release(std::move(_byteBuffer));
 }
 
 uint8_t *ByteBufferArrayBufferStorage::data() {
@@ -433,8 +447,15 @@ jni::local_ref<jni::JByteBuffer> JavaScriptBackedArrayBufferStorage::toDirectBuf
 }
 
 std::shared_ptr<jsi::MutableBuffer> JavaScriptBackedArrayBufferStorage::jsiMutableBuffer() {
-  auto byteBuffer = toDirectBuffer();
-  return std::make_shared<ByteBufferJSIMutableBuffer>(byteBuffer);
+  auto self = std::static_pointer_cast<JavaScriptBackedArrayBufferStorage>(shared_from_this());
+  auto result = std::make_shared<std::shared_ptr<jsi::MutableBuffer>>();
+  _executor->runSync([self, result] {
+    auto runtime = self->runtimeOrThrow();
+    jsi::Runtime &rt = runtime->get();
+    self->validateBounds(rt);
+    *result = copyToMemoryBuffer(self->_arrayBuffer->data(rt) + self->_offset, self->_length);
+  });
+  return *result;
 }
 
 jsi::Value JavaScriptBackedArrayBufferStorage::toJSIValue(jsi::Runtime &runtime) {
@@ -444,8 +465,7 @@ jsi::Value JavaScriptBackedArrayBufferStorage::toJSIValue(jsi::Runtime &runtime)
       if (_offset == 0 && _length == _arrayBuffer->size(runtime)) {
         return jsi::Value(runtime, *_arrayBuffer);
       }
-      auto byteBuffer = copyToDirectBuffer(_arrayBuffer->data(runtime) + _offset, _length);
-      auto mutableBuffer = std::make_shared<ByteBufferJSIMutableBuffer>(byteBuffer);
+      auto mutableBuffer = copyToMemoryBuffer(_arrayBuffer->data(runtime) + _offset, _length);
       return jsi::Value(runtime, runtime.createArrayBuffer(std::move(mutableBuffer)));
     }
   }
@@ -524,6 +544,8 @@ void ArrayBuffer::registerNatives() {
                    makeNativeMethod("isNativeBacked", ArrayBuffer::isNativeBacked),
                    makeNativeMethod("withJSBytes", ArrayBuffer::withJSBytes),
                    makeNativeMethod("withJSBytesAsync", ArrayBuffer::withJSBytesAsync),
+                   makeNativeMethod("allocatePooledNative", ArrayBuffer::allocatePooled),
+                   makeNativeMethod("getPoolStatsNative", ArrayBuffer::getPoolStats),
                  });
 }
 
@@ -534,6 +556,33 @@ jni::local_ref<ArrayBuffer::jhybriddata> ArrayBuffer::initHybrid(
   return makeCxxInstance(byteBuffer);
 }
 
+jni::local_ref<ArrayBuffer::javaobject> ArrayBuffer::allocatePooled(
+  [[maybe_unused]] jni::alias_ref<jni::JClass> clazz,
+  jint size
+) {
+  auto length = static_cast<size_t>(size);
+  auto buffer = MemoryBuffer::allocate(length);
+  // Pooled blocks keep the bytes of their previous buffers.
+  std::memset(buffer->data(), 0, length);
+  return ArrayBuffer::newObjectCxxArgs(
+    std::make_shared<MutableBufferViewArrayBufferStorage>(std::move(buffer), 0, length)
+  );
+}
+
+jni::local_ref<jni::JArrayLong> ArrayBuffer::getPoolStats(
+  [[maybe_unused]] jni::alias_ref<jni::JClass> clazz
+) {
+  auto stats = MemoryBufferPool::shared().getStats();
+  jlong values[] = {
+    static_cast<jlong>(stats.hits),
+    static_cast<jlong>(stats.misses),
+    static_cast<jlong>(stats.pooledBytes)
+  };
+  auto result = jni::JArrayLong::newArray(3);
+  result->setRegion(0, 3, values);
+  return result;
+}
+
 jni::local_ref<ArrayBuffer::javaobject> ArrayBuffer::newInstance(
   JSIContext *jsiContext,
   jsi::Runtime &runtime,
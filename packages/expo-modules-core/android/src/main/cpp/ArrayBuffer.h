@@ -184,6 +184,19 @@ public:
     jni::alias_ref<jni::JByteBuffer> byteBuffer
   );
 
+  /**
+   * Creates a zero-filled ArrayBuffer backed by a block from the shared `MemoryBufferPool`.
+   */
+  static jni::local_ref<ArrayBuffer::javaobject> allocatePooled(
+    jni::alias_ref<jni::JClass> clazz,
+    jint size
+  );
+
+  /**
+   * Returns the statistics of the shared `MemoryBufferPool` as `[hits, misses, pooledBytes]`.
+   */
+  static jni::local_ref<jni::JArrayLong> getPoolStats(jni::alias_ref<jni::JClass> clazz);
+
   static jni::local_ref<ArrayBuffer::javaobject> newInstance(
     JSIContext *jsiContext,
     jsi::Runtime& runtime,
@@ -0,0 +1,24 @@
+// Copyright © 2026-present 650 Industries, Inc. (aka Expo)
+
+#include "DirectBufferPool.h"
+
+#include <cstring>
+
+namespace expo {
+
+DirectBufferPool::Buffer DirectBufferPool::acquire(size_t size, bool zeroFill) {
+  auto memory = MemoryBuffer::allocate(size);
+  if (zeroFill) {
+    // Pooled blocks keep the bytes of their previous buffers.
+    std::memset(memory->data(), 0, size);
+  }
+
+  auto byteBuffer = jni::JByteBuffer::wrapBytes(memory->data(), size);
+  byteBuffer->order(jni::JByteOrder::nativeOrder());
+  return {
+    .byteBuffer = std::move(byteBuffer),
+    .memory = std::move(memory)
+  };
+}
+
+} // namespace expo
@@ -0,0 +1,40 @@
+// Copyright © 2026-present 650 Industries, Inc. (aka Expo)
+
+#pragma once
+
+#include "ExpoHeader.pch"
+#include "MemoryBuffer.h"
+
+#include <fbjni/ByteBuffer.h>
+
+#include <memory>
+
+namespace jni = facebook::jni;
+
+namespace expo {
+
+/**
+ * Hands out direct `ByteBuffer`s backed by blocks of the shared `MemoryBufferPool`,
+ * so native-owned buffers don't need a new `allocateDirect` allocation each time.
+ */
+class DirectBufferPool {
+public:
+  struct Buffer {
+    /**
+     * A direct buffer pointing into `memory`. It must not be used after `memory` is released.
+     */
+    jni::local_ref<jni::JByteBuffer> byteBuffer;
+
+    /**
+     * Owner of the pooled block. The block goes back to the pool once it's released.
+     */
+    std::shared_ptr<MemoryBuffer> memory;
+  };
+
+  /**
+   * Returns a buffer of the given size. Its bytes are uninitialized unless `zeroFill` is set.
+   */
+  static Buffer acquire(size_t size, bool zeroFill = false);
+};
+
+} // namespace expo
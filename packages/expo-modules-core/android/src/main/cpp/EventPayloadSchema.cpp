@@ -0,0 +1,146 @@
+// Copyright © 2026-present 650 Industries, Inc. (aka Expo)
+
+#include "EventPayloadSchema.h"
+#include "JSIUtils.h"
+
+#include <cstring>
+#include <mutex>
+#include <unordered_map>
+
+namespace expo {
+
+namespace {
+
+struct EventPayloadSchemasCache {
+  static constexpr jsi::UUID uuid{0x114bdf2b, 0xb631, 0x4629, 0x8037, 0xac7df4e39535};
+
+  EventPayloadSchemasCache(jsi::Runtime &runtime) {}
+
+  std::unordered_map<int, std::vector<jsi::PropNameID>> propNames;
+};
+
+std::mutex schemasMutex;
+std::vector<std::shared_ptr<const EventPayloadSchema>> schemas;
+
+size_t getFieldSize(EventPayloadSchema::FieldType type) {
+  switch (type) {
+    case EventPayloadSchema::FieldType::INT:
+      return sizeof(int32_t);
+    case EventPayloadSchema::FieldType::LONG:
+      return sizeof(int64_t);
+    case EventPayloadSchema::FieldType::FLOAT:
+      return sizeof(float);
+    case EventPayloadSchema::FieldType::DOUBLE:
+      return sizeof(double);
+    case EventPayloadSchema::FieldType::BOOLEAN:
+      return sizeof(uint8_t);
+  }
+  return 0;
+}
+
+template<typename T>
+T readField(const uint8_t *payload, size_t offset) {
+  T result;
+  memcpy(&result, payload + offset, sizeof(T));
+  return result;
+}
+
+} // namespace
+
+int EventPayloadSchema::registerSchema(
+  std::vector<std::string> fieldNames,
+  const std::vector<FieldType> &fieldTypes
+) {
+  std::lock_guard lock(schemasMutex);
+
+  // Schemas with the same fields share the ID, so the prop names are interned only once per runtime.
+  for (const auto &schema: schemas) {
+    if (schema->fieldNames != fieldNames || schema->fields.size() != fieldTypes.size()) {
+      continue;
+    }
+    bool haveSameTypes = true;
+    for (size_t i = 0; i < fieldTypes.size(); i++) {
+      if (schema->fields[i].type != fieldTypes[i]) {
+        haveSameTypes = false;
+        break;
+      }
+    }
+    if (haveSameTypes) {
+      return schema->id;
+    }
+  }
+
+  int id = static_cast<int>(schemas.size());
+  schemas.push_back(std::make_shared<const EventPayloadSchema>(id, std::move(fieldNames), fieldTypes));
+  return id;
+}
+
+std::shared_ptr<const EventPayloadSchema> EventPayloadSchema::get(int id) {
+  std::lock_guard lock(schemasMutex);
+  if (id < 0 || static_cast<size_t>(id) >= schemas.size()) {
+    return nullptr;
+  }
+  return schemas[id];
+}
+
+EventPayloadSchema::EventPayloadSchema(
+  int id,
+  std::vector<std::string> fieldNames,
+  const std::vector<FieldType> &fieldTypes
+) : id(id), fieldNames(std::move(fieldNames)) {
+  fields.reserve(fieldTypes.size());
+  for (auto type: fieldTypes) {
+    fields.push_back({type, size});
+    size += getFieldSize(type);
+  }
+}
+
+size_t EventPayloadSchema::getSize() const {
+  return size;
+}
+
+const std::vector<jsi::PropNameID> &EventPayloadSchema::getPropNames(jsi::Runtime &rt) const {
+  auto &propNames = common::getRuntimeCache<EventPayloadSchemasCache>(rt).propNames;
+  auto it = propNames.find(id);
+  if (it != propNames.end()) {
+    return it->second;
+  }
+
+  std::vector<jsi::PropNameID> names;
+  names.reserve(fieldNames.size());
+  for (const auto &name: fieldNames) {
+    names.push_back(jsi::PropNameID::forUtf8(rt, name));
+  }
+  return propNames.emplace(id, std::move(names)).first->second;
+}
+
+jsi::Object EventPayloadSchema::decode(jsi::Runtime &rt, const uint8_t *payload) const {
+  const auto &propNames = getPropNames(rt);
+  jsi::Object result(rt);
+
+  for (size_t i = 0; i < fields.size(); i++) {
+    const Field &field = fields[i];
+    jsi::Value value;
+    switch (field.type) {
+      case FieldType::INT:
+        value = jsi::Value(readField<int32_t>(payload, field.offset));
+        break;
+      case FieldType::LONG:
+        value = jsi::Value(static_cast<double>(readField<int64_t>(payload, field.offset)));
+        break;
+      case FieldType::FLOAT:
+        value = jsi::Value(static_cast<double>(readField<float>(payload, field.offset)));
+        break;
+      case FieldType::DOUBLE:
+        value = jsi::Value(readField<double>(payload, field.offset));
+        break;
+      case FieldType::BOOLEAN:
+        value = jsi::Value(readField<uint8_t>(payload, field.offset) != 0);
+        break;
+    }
+    result.setProperty(rt, propNames[i], value);
+  }
+  return result;
+}
+
+} // namespace expo
@@ -0,0 +1,71 @@
+// Copyright © 2026-present 650 Industries, Inc. (aka Expo)
+
+#pragma once
+
+#include "ExpoHeader.pch"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace jsi = facebook::jsi;
+
+namespace expo {
+
+/**
+ * The layout of binary event payloads declared by `EventPayloadSchema` in Kotlin.
+ * Payloads consist of fields of fixed numeric types, laid out one after another without padding
+ * in the native byte order. They're decoded into JS objects using the names interned once per runtime.
+ * Schemas are registered once and live as long as the process.
+ */
+class EventPayloadSchema {
+public:
+  /**
+   * Raw values have to be in sync with `EventPayloadSchema.FieldType` in Kotlin.
+   */
+  enum class FieldType : int {
+    INT = 0,
+    LONG = 1,
+    FLOAT = 2,
+    DOUBLE = 3,
+    BOOLEAN = 4
+  };
+
+  /**
+   * Registers the schema with the given fields and returns its ID.
+   * If a schema with the same fields is already registered, returns the ID of that schema.
+   */
+  static int registerSchema(std::vector<std::string> fieldNames, const std::vector<FieldType> &fieldTypes);
+
+  /**
+   * Returns the schema with the given ID or `nullptr` if there is no such schema.
+   */
+  static std::shared_ptr<const EventPayloadSchema> get(int id);
+
+  EventPayloadSchema(int id, std::vector<std::string> fieldNames, const std::vector<FieldType> &fieldTypes);
+
+  /**
+   * The size of a single payload in bytes.
+   */
+  size_t getSize() const;
+
+  /**
+   * Creates a JS object from the payload, which has to be at least `getSize()` bytes long.
+   */
+  jsi::Object decode(jsi::Runtime &rt, const uint8_t *payload) const;
+
+private:
+  struct Field {
+    FieldType type;
+    size_t offset;
+  };
+
+  const int id;
+  const std::vector<std::string> fieldNames;
+  std::vector<Field> fields;
+  size_t size = 0;
+
+  const std::vector<jsi::PropNameID> &getPropNames(jsi::Runtime &rt) const;
+};
+
+} // namespace expo
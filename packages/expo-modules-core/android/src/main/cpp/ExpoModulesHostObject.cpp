@@ -6,6 +6,7 @@
 
 #include <react/bridging/LongLivedObject.h>
 
+
 namespace jsi = facebook::jsi;
 
 namespace expo {
@@ -27,19 +28,24 @@ jsi::Value ExpoModulesHostObject::get(jsi::Runtime &runtime, const jsi::PropName
     return jsi::Value::undefined();
   }
 
-  auto cName = name.utf8(runtime);
+  auto &modulesTable = getModules();
+  auto entry = modulesTable.find(name.utf8(runtime));
+  if (entry == modulesTable.end()) {
+    return jsi::Value::undefined();
+  }
 
-  if (UniqueJSIObject &cachedObject = modulesCache[cName]) {
+  const std::string &cName = entry->first;
+  UniqueJSIObject &cachedObject = entry->second;
+  if (cachedObject) {
     return jsi::Value(runtime, *cachedObject);
   }
 
-  if (!installer->hasModule(cName)) {
-    return jsi::Value::undefined();
-  }
+  // The module is fetched once, when the lazy object is initialized, and reused to define its members.
+  auto module = std::make_shared<jni::global_ref<JavaScriptModuleObject::javaobject>>();
 
   // Create a lazy object for the specific module. It defers initialization of the final module object.
   LazyObject::Shared moduleLazyObject = std::make_shared<LazyObject>(
-    [this, cName](jsi::Runtime &rt) {
+    [this, cName, module](jsi::Runtime &rt) {
       // Check if the installer has been deallocated.
       // If so, return nullptr to avoid a "field operation on NULL object" crash.
       // As it's probably the best we can do in this case.
@@ -47,16 +53,29 @@ jsi::Value ExpoModulesHostObject::get(jsi::Runtime &runtime, const jsi::PropName
         return std::shared_ptr<jsi::Object>(nullptr);
       }
 
-      auto module = installer->getModule(cName);
-      return module->cthis()->getJSIObject(rt);
+      *module = jni::make_global(installer->getModule(cName));
+      return (*module)->cthis()->getLazyJSIObject(rt);
+    },
+    // Functions, constants and properties of the module are created one by one, on first access.
+    [this, module](jsi::Runtime &rt, jsi::Object &moduleObject, const std::optional<std::string> &memberName) {
+      if (installer->wasDeallocated() || !*module) {
+        return;
+      }
+      (*module)->cthis()->decorateMember(rt, moduleObject, memberName);
+    },
+    [this, module]() {
+      if (installer->wasDeallocated() || !*module) {
+        return std::vector<std::string>();
+      }
+      return (*module)->cthis()->getLazyMemberNames();
     }
   );
 
   // Save the module's lazy host object for later use.
-  modulesCache[cName] = std::make_unique<jsi::Object>(
+  cachedObject = std::make_unique<jsi::Object>(
     jsi::Object::createFromHostObject(runtime, moduleLazyObject));
 
-  return jsi::Value(runtime, *modulesCache[cName]);
+  return jsi::Value(runtime, *cachedObject);
 }
 
 void ExpoModulesHostObject::set(jsi::Runtime &runtime, const jsi::PropNameID &name,
@@ -68,15 +87,43 @@ void ExpoModulesHostObject::set(jsi::Runtime &runtime, const jsi::PropNameID &na
 }
 
 std::vector<jsi::PropNameID> ExpoModulesHostObject::getPropertyNames(jsi::Runtime &rt) {
-  auto names = installer->getModulesName();
-  size_t size = names->size();
+  if (installer->wasDeallocated()) {
+    return {};
+  }
+
+  getModules();
   std::vector<jsi::PropNameID> result;
-  result.reserve(size);
-  for (int i = 0; i < size; i++) {
-    result.push_back(
-      jsi::PropNameID::forUtf8(rt, names->getElement(i)->toStdString())
-    );
+  result.reserve(moduleNames.size());
+  for (const auto &moduleName: moduleNames) {
+    result.push_back(jsi::PropNameID::forUtf8(rt, moduleName));
   }
   return result;
 }
+
+void ExpoModulesHostObject::loadModules() {
+  // The version is read before the names, so changes made in the meantime make the table reload again.
+  loadedModulesVersion = installer->getModulesVersion();
+
+  auto jModuleNames = installer->getModulesName();
+  size_t size = jModuleNames->size();
+
+  // Module objects created for the previous table are dropped, as the modules may have been replaced.
+  modules.clear();
+  modules.reserve(size);
+  moduleNames.clear();
+  moduleNames.reserve(size);
+
+  for (size_t i = 0; i < size; i++) {
+    auto moduleName = jModuleNames->getElement(i)->toStdString();
+    modules.emplace(moduleName, nullptr);
+    moduleNames.push_back(std::move(moduleName));
+  }
+}
+
+std::unordered_map<std::string, UniqueJSIObject> &ExpoModulesHostObject::getModules() {
+  if (loadedModulesVersion != installer->getModulesVersion()) {
+    loadModules();
+  }
+  return modules;
+}
 } // namespace expo
@@ -5,7 +5,8 @@
 #include "ExpoHeader.pch"
 #include "JSIContext.h"
 
-#import <unordered_map>
+#include <optional>
+#include <unordered_map>
 
 namespace jsi = facebook::jsi;
 
@@ -30,8 +31,34 @@ public:
 
   std::vector<jsi::PropNameID> getPropertyNames(jsi::Runtime &rt) override;
 
+  /**
+   * Fetches names of all available modules with a single call into Kotlin and builds the module table.
+   * It's called when the host object is installed and again after the registered modules change.
+   */
+  void loadModules();
+
 private:
   JSIContext *installer;
-  std::unordered_map<std::string, UniqueJSIObject> modulesCache;
+
+  /**
+   * A table of all available modules keyed by their names, so looking up a module doesn't cross JNI.
+   * Values are the module objects, created on first access.
+   */
+  std::unordered_map<std::string, UniqueJSIObject> modules;
+
+  /**
+   * Names of the modules in the order they were registered.
+   */
+  std::vector<std::string> moduleNames;
+
+  /**
+   * The version of the registered modules the table was loaded for, see `JSIContext::getModulesVersion`.
+   */
+  std::optional<uint32_t> loadedModulesVersion;
+
+  /**
+   * Returns the module table, reloading it first if the registered modules have changed.
+   */
+  std::unordered_map<std::string, UniqueJSIObject> &getModules();
 };
 } // namespace expo
@@ -0,0 +1,80 @@
+// Copyright © 2026-present 650 Industries, Inc. (aka Expo)
+
+#include "JClassReturnTypeCache.h"
+
+namespace expo {
+
+namespace {
+
+jclass findGlobalClass(JNIEnv *env, const char *name) {
+  jclass localClass = env->FindClass(name);
+  auto globalClass = (jclass) env->NewGlobalRef(localClass);
+  env->DeleteLocalRef(localClass);
+  return globalClass;
+}
+
+} // namespace
+
+JClassReturnTypeCache::JClassReturnTypeCache(JNIEnv *env) : exactClasses{{
+  {findGlobalClass(env, "java/lang/Double"), ReturnType::DOUBLE},
+  {findGlobalClass(env, "java/lang/Integer"), ReturnType::INT},
+  {findGlobalClass(env, "java/lang/String"), ReturnType::STRING},
+  {findGlobalClass(env, "java/lang/Boolean"), ReturnType::BOOLEAN},
+  {findGlobalClass(env, "java/lang/Long"), ReturnType::LONG},
+  {findGlobalClass(env, "java/lang/Float"), ReturnType::FLOAT},
+}} {}
+
+ReturnType JClassReturnTypeCache::get(JNIEnv *env, jobject value, Resolver resolver) {
+  jclass clazz = env->GetObjectClass(value);
+
+  for (const auto &exactClass: exactClasses) {
+    if (env->IsSameObject(exactClass.clazz, clazz)) {
+      env->DeleteLocalRef(clazz);
+      return exactClass.returnType;
+    }
+  }
+
+  // Entries are never removed, so the ones below the loaded size can be read without the lock.
+  size_t cachedCount = size.load(std::memory_order_acquire);
+  for (size_t i = 0; i < cachedCount; i++) {
+    if (env->IsSameObject(entries[i].clazz, clazz)) {
+      env->DeleteLocalRef(clazz);
+      return entries[i].returnType;
+    }
+  }
+
+  ReturnType returnType = resolver(env, value);
+
+  {
+    std::lock_guard<std::mutex> lock(insertMutex);
+    size_t currentCount = size.load(std::memory_order_relaxed);
+    bool isCached = false;
+    // Another thread might have cached the class in the meantime.
+    for (size_t i = cachedCount; i < currentCount; i++) {
+      if (env->IsSameObject(entries[i].clazz, clazz)) {
+        isCached = true;
+        break;
+      }
+    }
+    if (!isCached && currentCount < capacity) {
+      entries[currentCount] = {(jclass) env->NewGlobalRef(clazz), returnType};
+      size.store(currentCount + 1, std::memory_order_release);
+    }
+  }
+
+  env->DeleteLocalRef(clazz);
+  return returnType;
+}
+
+void JClassReturnTypeCache::unLoad(JNIEnv *env) {
+  std::lock_guard<std::mutex> lock(insertMutex);
+  size_t cachedCount = size.exchange(0);
+  for (size_t i = 0; i < cachedCount; i++) {
+    env->DeleteGlobalRef(entries[i].clazz);
+  }
+  for (auto &exactClass: exactClasses) {
+    env->DeleteGlobalRef(exactClass.clazz);
+  }
+}
+
+} // namespace expo
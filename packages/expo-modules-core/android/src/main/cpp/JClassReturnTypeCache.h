@@ -0,0 +1,62 @@
+// Copyright © 2026-present 650 Industries, Inc. (aka Expo)
+
+#pragma once
+
+#include "ExpoHeader.pch"
+#include "types/ReturnType.h"
+
+#include <array>
+#include <atomic>
+#include <mutex>
+
+namespace expo {
+
+/**
+ * Maps Java classes to the `ReturnType` that should be used to convert their instances to JS,
+ * so the type of a returned value is found without probing a chain of `IsInstanceOf` checks every time.
+ * The most common classes (boxed primitives and strings) are final, so they're matched by comparing
+ * the class with a handful of preloaded ones. Other classes are kept in a small table that is scanned
+ * the same way, as Java classes have no identity that could be hashed without an upcall to Java.
+ * Lookups are lock-free, inserting a class takes the lock.
+ * Once the table is full, the types of new classes are resolved on each lookup.
+ */
+class JClassReturnTypeCache {
+public:
+  typedef ReturnType (*Resolver)(JNIEnv *env, jobject value);
+
+  /**
+   * The maximum number of cached classes other than the preloaded ones.
+   * It's small, because each cached class costs an `IsSameObject` call on lookups of the classes cached after it.
+   */
+  static constexpr size_t capacity = 16;
+
+  explicit JClassReturnTypeCache(JNIEnv *env);
+
+  /**
+   * Returns the return type for the class of the given non-null value.
+   * The resolver is called only for classes that are not cached yet.
+   */
+  ReturnType get(JNIEnv *env, jobject value, Resolver resolver);
+
+  void unLoad(JNIEnv *env);
+
+private:
+  struct Entry {
+    jclass clazz;
+    ReturnType returnType;
+  };
+
+  /**
+   * Final classes whose instances are returned most often, checked before the table.
+   */
+  std::array<Entry, 6> exactClasses;
+
+  std::mutex insertMutex;
+  std::array<Entry, capacity> entries;
+  /**
+   * The number of entries in use. Entries are written before the size is increased, hence the acquire loads.
+   */
+  std::atomic<size_t> size{0};
+};
+
+} // namespace expo
@@ -2,11 +2,18 @@
 
 #include "JNIDeallocator.h"
 
+#include <android/log.h>
+
 namespace expo {
 
 void JNIDeallocator::addReference(
   jni::local_ref<Destructible::javaobject> jniObject
-) noexcept {
+) {
+  auto batch = JNIDeallocatorBatch::current;
+  if (batch != nullptr && batch->tryAdd(self(), jniObject)) {
+    return;
+  }
+
   const static auto method = JNIDeallocator::javaClassLocal()
     ->getMethod<void(jni::local_ref<Destructible>)>(
       "addReference"
@@ -14,4 +21,55 @@ void JNIDeallocator::addReference(
   method(self(), std::move(jniObject));
 }
 
+thread_local JNIDeallocatorBatch *JNIDeallocatorBatch::current = nullptr;
+
+JNIDeallocatorBatch::JNIDeallocatorBatch(
+  jni::alias_ref<JNIDeallocator::javaobject> deallocator
+) : deallocator(deallocator), previous(current) {
+  current = this;
+}
+
+JNIDeallocatorBatch::~JNIDeallocatorBatch() noexcept {
+  current = previous;
+  try {
+    flush();
+  } catch (const jni::JniException &exception) {
+    __android_log_print(ANDROID_LOG_ERROR, "ExpoModulesCore", "Cannot register references in the deallocator: %s", exception.what());
+  }
+}
+
+bool JNIDeallocatorBatch::tryAdd(
+  jobject deallocatorObject,
+  jni::alias_ref<Destructible::javaobject> jniObject
+) {
+  // Comparing the references is enough, the deallocator is always accessed through the same global reference.
+  if (!deallocator || deallocator.get() != deallocatorObject) {
+    return false;
+  }
+
+  if (!references) {
+    references = jni::JArrayClass<Destructible::javaobject>::newArray(capacity);
+  }
+  references->setElement(count++, jniObject.get());
+  if (count == capacity) {
+    flush();
+  }
+  return true;
+}
+
+void JNIDeallocatorBatch::flush() {
+  if (count == 0) {
+    return;
+  }
+
+  const static auto method = JNIDeallocator::javaClassLocal()
+    ->getMethod<void(jni::alias_ref<jni::JArrayClass<Destructible::javaobject>>, jint)>(
+      "addReferences"
+    );
+  // Reset the counter first, so the references aren't passed again from the destructor if Kotlin throws.
+  auto size = count;
+  count = 0;
+  method(deallocator, references, size);
+}
+
 } // namespace expo
@@ -17,9 +17,56 @@ class JNIDeallocator : public jni::JavaClass<JNIDeallocator> {
 public:
   static auto constexpr kJavaDescriptor = "Lexpo/modules/kotlin/jni/JNIDeallocator;";
 
+  /**
+   * Adds the reference to the deallocator. If there is a `JNIDeallocatorBatch` for this deallocator
+   * on the current thread, the reference is added to the batch instead.
+   */
   void addReference(
     jni::local_ref<Destructible::javaobject> jniObject
-  ) noexcept;
+  );
+};
+
+/**
+ * Collects the references that are added to the given deallocator on the current thread while the batch
+ * is alive and passes them to the deallocator in bulk, so converting many values, like array buffers,
+ * doesn't require a separate call to the deallocator for each of them. The references are passed
+ * when the batch is full, when `flush` is called and when the batch goes out of scope.
+ * Call `flush` at the end of the scope to get the errors thrown by Kotlin, the destructor can only log them.
+ * Only references added through the same `jobject` the batch was created with are collected,
+ * which is the case for the global reference kept by the JSIContext.
+ * Wrappers of JS values, like `JavaScriptObject`, aren't tracked by the deallocator, see `JSIHandleTable`.
+ */
+class JNIDeallocatorBatch {
+public:
+  explicit JNIDeallocatorBatch(jni::alias_ref<JNIDeallocator::javaobject> deallocator);
+
+  ~JNIDeallocatorBatch() noexcept;
+
+  JNIDeallocatorBatch(const JNIDeallocatorBatch &) = delete;
+
+  JNIDeallocatorBatch &operator=(const JNIDeallocatorBatch &) = delete;
+
+  /**
+   * Passes the collected references to the deallocator.
+   */
+  void flush();
+
+private:
+  friend class JNIDeallocator;
+
+  static constexpr jsize capacity = 256;
+
+  /**
+   * The innermost batch of the current thread.
+   */
+  static thread_local JNIDeallocatorBatch *current;
+
+  jni::alias_ref<JNIDeallocator::javaobject> deallocator;
+  jni::local_ref<jni::JArrayClass<Destructible::javaobject>> references;
+  jsize count = 0;
+  JNIDeallocatorBatch *previous;
+
+  bool tryAdd(jobject deallocatorObject, jni::alias_ref<Destructible::javaobject> jniObject);
 };
 
 } // namespace expo
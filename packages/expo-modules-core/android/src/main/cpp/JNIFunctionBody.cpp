@@ -3,6 +3,8 @@
 #include "JNIFunctionBody.h"
 #include "Exceptions.h"
 
+#include <array>
+
 namespace jni = facebook::jni;
 namespace react = facebook::react;
 
@@ -51,6 +53,34 @@ JNIFunctionBody::invoke(
   return jni::adopt_local(static_cast<jni::JniType<jni::JObject>>(result));
 }
 
+jni::local_ref<jni::JObject>
+JNIPrimitiveFunctionBody::invoke(
+  jobject self,
+  const jdouble *args,
+  size_t count
+) {
+  // Same as in `JNIFunctionBody::invoke`, methods have to be obtained from the base class.
+  static const auto methods = []() {
+    auto clazz = jni::findClassLocal("expo/modules/kotlin/jni/JNIPrimitiveFunctionBody");
+    return std::array<jmethodID, maxArgsCount + 1>{
+      clazz->getMethod<jni::local_ref<jni::JObject>()>("invokeWithPrimitives", "()Ljava/lang/Object;").getId(),
+      clazz->getMethod<jni::local_ref<jni::JObject>(jdouble)>("invokeWithPrimitives", "(D)Ljava/lang/Object;").getId(),
+      clazz->getMethod<jni::local_ref<jni::JObject>(jdouble, jdouble)>("invokeWithPrimitives", "(DD)Ljava/lang/Object;").getId(),
+      clazz->getMethod<jni::local_ref<jni::JObject>(jdouble, jdouble, jdouble)>("invokeWithPrimitives", "(DDD)Ljava/lang/Object;").getId(),
+      clazz->getMethod<jni::local_ref<jni::JObject>(jdouble, jdouble, jdouble, jdouble)>("invokeWithPrimitives", "(DDDD)Ljava/lang/Object;").getId()
+    };
+  }();
+
+  jvalue jValues[maxArgsCount];
+  for (size_t i = 0; i < count; i++) {
+    jValues[i].d = args[i];
+  }
+
+  auto result = jni::Environment::current()->CallObjectMethodA(self, methods[count], jValues);
+  throwPendingJniExceptionAsCppException();
+  return jni::adopt_local(static_cast<jni::JniType<jni::JObject>>(result));
+}
+
 void JNIAsyncFunctionBody::invoke(
   jobject self,
   jobjectArray args,
@@ -46,6 +46,34 @@ public:
   );
 };
 
+/**
+ * A CPP part of the expo.modules.kotlin.jni.JNIPrimitiveFunctionBody class.
+ * It represents the Kotlin's promise-less function that takes only numbers and booleans.
+ */
+class JNIPrimitiveFunctionBody : public jni::JavaClass<JNIPrimitiveFunctionBody> {
+public:
+  static auto constexpr kJavaDescriptor = "Lexpo/modules/kotlin/jni/JNIPrimitiveFunctionBody;";
+
+  /**
+   * The maximum number of arguments that can be passed through JNI without boxing them.
+   */
+  static constexpr size_t maxArgsCount = 4;
+
+  /**
+   * Invokes a Kotlin's implementation of this function, passing arguments as unboxed doubles.
+   * Booleans are represented as `0` or `1`.
+   *
+   * @param args
+   * @param count number of arguments, not greater than `maxArgsCount`
+   * @return result of the Kotlin function
+   */
+  static jni::local_ref<jni::JObject> invoke(
+    jobject self,
+    const jdouble *args,
+    size_t count
+  );
+};
+
 /**
  * A CPP part of the expo.modules.kotlin.jni.JNIAsyncFunctionBody class.
  * It represents the Kotlin's promise function.
@@ -2,6 +2,8 @@
 
 #include "ExpoHeader.pch"
 #include "RuntimeHolder.h"
+#include "PromiseSettlementQueueTester.h"
+#include "JNIWorkerPoolTester.h"
 #include "JSIContext.h"
 #include "JavaScriptModuleObject.h"
 #include "JavaScriptValue.h"
@@ -9,6 +11,7 @@
 #include "JavaScriptWeakObject.h"
 #include "JavaScriptFunction.h"
 #include "ArrayBuffer.h"
+#include "JNIWorkerPool.h"
 #include "JavaScriptArrayBuffer.h"
 #include "JavaScriptTypedArray.h"
 #include "NativeArrayBuffer.h"
@@ -28,6 +31,8 @@
 
 // Install all jni bindings
 JNIEXPORT jint JNICALL JNI_OnLoad(JavaVM *vm, void *) {
+  expo::JNIWorkerPool::initialize(vm);
+
   return facebook::jni::initialize(vm, [] {
     // Loads references to often use Java classes
     expo::JCacheHolder::init(jni::Environment::current());
@@ -36,6 +41,8 @@ JNIEXPORT jint JNICALL JNI_OnLoad(JavaVM *vm, void *) {
 
 #if UNIT_TEST
     expo::RuntimeHolder::registerNatives();
+    expo::PromiseSettlementQueueTester::registerNatives();
+    expo::JNIWorkerPoolTester::registerNatives();
 #endif
     expo::MainRuntimeInstaller::registerNatives();
     expo::JSIContext::registerNatives();
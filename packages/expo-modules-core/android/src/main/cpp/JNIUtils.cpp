@@ -3,6 +3,7 @@
 #include "ExpoHeader.pch"
 #include "JNIUtils.h"
 #include "EventEmitter.h"
+#include "EventPayloadSchema.h"
 #include "JSIUtils.h"
 #include "types/JNIToJSIConverter.h"
 #include "JSIContext.h"
@@ -72,7 +73,13 @@ void JNIUtils::registerNatives() {
                                        makeNativeMethod("emitEvent",
                                                         JNIUtils::emitEventOnJavaScriptModule),
                                        makeNativeMethod("emitEvent",
-                                                        JNIUtils::emitEventOnWeakJavaScriptObject)
+                                                        JNIUtils::emitEventOnWeakJavaScriptObject),
+                                       makeNativeMethod("emitEvent",
+                                                        JNIUtils::emitEventWithPayloadOnJavaScriptModule),
+                                       makeNativeMethod("registerEventPayloadSchema",
+                                                        JNIUtils::registerEventPayloadSchema),
+                                       makeNativeMethod("internEventName",
+                                                        JNIUtils::internEventName)
                                      });
 }
 
@@ -80,7 +87,7 @@ void JNIUtils::emitEventOnWeakJavaScriptObject(
   [[maybe_unused]] jni::alias_ref<jni::JClass> clazz,
   jni::alias_ref<JavaScriptWeakObject::javaobject> jsiThis,
   jni::alias_ref<jni::HybridClass<JSIContext>::javaobject> jsiContextRef,
-  jni::alias_ref<jstring> eventName,
+  jint eventId,
   jni::alias_ref<jni::JArrayClass<jobject>> args
 ) {
   jni::global_ref<jni::JArrayClass<jobject>> globalArgs = jni::make_global(args);
@@ -88,7 +95,7 @@ void JNIUtils::emitEventOnWeakJavaScriptObject(
   JNIUtils::emitEventOnJSIObject(
     jsiThis->cthis()->getWeak(),
     jsiContextRef,
-    eventName,
+    eventId,
     [args = globalArgs](jsi::Runtime &rt) -> std::vector<jsi::Value> {
       auto localArgs = jni::static_ref_cast<jni::JArrayClass<jobject>>(args);
 
@@ -112,15 +119,17 @@ void JNIUtils::emitEventOnJavaScriptObject(
   [[maybe_unused]] jni::alias_ref<jni::JClass> clazz,
   jni::alias_ref<JavaScriptObject::javaobject> jsiThis,
   jni::alias_ref<jni::HybridClass<JSIContext>::javaobject> jsiContextRef,
-  jni::alias_ref<jstring> eventName,
+  jint eventId,
   jni::alias_ref<jni::JArrayClass<jobject>> args
 ) {
   jni::global_ref<jni::JArrayClass<jobject>> globalArgs = jni::make_global(args);
 
+  auto jsObject = jsiThis->cthis()->get();
   JNIUtils::emitEventOnJSIObject(
-    jsiThis->cthis()->get(),
+    jsObject,
+    jsObject.get(),
     jsiContextRef,
-    eventName,
+    eventId,
     [args = globalArgs](jsi::Runtime &rt) -> std::vector<jsi::Value> {
       auto localArgs = jni::static_ref_cast<jni::JArrayClass<jobject>>(args);
 
@@ -144,15 +153,16 @@ void JNIUtils::emitEventOnJavaScriptModule(
   [[maybe_unused]] jni::alias_ref<jni::JClass> clazz,
   jni::alias_ref<JavaScriptModuleObject::javaobject> jsiThis,
   jni::alias_ref<jni::HybridClass<JSIContext>::javaobject> jsiContextRef,
-  jni::alias_ref<jstring> eventName,
+  jint eventId,
   jni::alias_ref<jni::JMap<jstring, jobject>> eventBody
 ) {
   auto globalEventBody = jni::make_global(eventBody);
 
   JNIUtils::emitEventOnJSIObject(
     jsiThis->cthis()->getCachedJSIObject(),
+    jsiThis->cthis(),
     jsiContextRef,
-    eventName,
+    eventId,
     [args = std::move(globalEventBody)](jsi::Runtime &rt) -> std::vector<jsi::Value> {
       JNIEnv *env = jni::Environment::current();
 
@@ -164,66 +174,138 @@ void JNIUtils::emitEventOnJavaScriptModule(
   );
 }
 
-void JNIUtils::emitEventOnJSIObject(
-  std::weak_ptr<jsi::WeakObject> jsiThis,
+void JNIUtils::emitEventWithPayloadOnJavaScriptModule(
+  [[maybe_unused]] jni::alias_ref<jni::JClass> clazz,
+  jni::alias_ref<JavaScriptModuleObject::javaobject> jsiThis,
   jni::alias_ref<jni::HybridClass<JSIContext>::javaobject> jsiContextRef,
-  jni::alias_ref<jstring> eventName,
-  ArgsProvider argsProvider
+  jint eventId,
+  jint payloadSchemaId,
+  jni::alias_ref<jni::JByteBuffer> payload
 ) {
-  const std::string name = eventName->toStdString();
+  auto schema = EventPayloadSchema::get(payloadSchemaId);
+  if (!schema || payload->getDirectSize() < schema->getSize()) {
+    throwNewJavaException(
+      UnexpectedException::create("Event payload doesn't match its schema.").get()
+    );
+  }
 
-  const JSIContext *jsiContext = jsiContextRef->cthis();
+  // Copies the payload, so the Kotlin side can reuse its buffer right away.
+  const uint8_t *bytes = payload->getDirectBytes();
+  std::vector<uint8_t> payloadCopy(bytes, bytes + schema->getSize());
 
-  jsiContext->runtimeHolder->jsInvoker->invokeAsync([
-                                                      jsiContext,
-                                                      name = name,
-                                                      argsProvider = std::move(argsProvider),
-                                                      weakThis = std::move(jsiThis)
-                                                    ]() {
-    std::shared_ptr<jsi::WeakObject> jsWeakThis = weakThis.lock();
-    if (!jsWeakThis) {
-      return;
+  JNIUtils::emitEventOnJSIObject(
+    jsiThis->cthis()->getCachedJSIObject(),
+    jsiThis->cthis(),
+    jsiContextRef,
+    eventId,
+    [schema = std::move(schema), payload = std::move(payloadCopy)](jsi::Runtime &rt) -> std::vector<jsi::Value> {
+      std::vector<jsi::Value> result;
+      result.push_back(schema->decode(rt, payload.data()));
+      return result;
     }
+  );
+}
+
+jint JNIUtils::registerEventPayloadSchema(
+  [[maybe_unused]] jni::alias_ref<jni::JClass> clazz,
+  jni::alias_ref<jni::JArrayClass<jstring>> fieldNames,
+  jni::alias_ref<jni::JArrayInt> fieldTypes
+) {
+  size_t size = fieldNames->size();
+  std::vector<std::string> names;
+  names.reserve(size);
+  for (size_t i = 0; i < size; i++) {
+    names.push_back(fieldNames->getElement(i)->toStdString());
+  }
 
-    // TODO(@lukmccall): refactor when jsInvoker receives a runtime as a parameter
-    jsi::Runtime &rt = jsiContext->runtimeHolder->get();
+  if (fieldTypes->size() != size) {
+    throwNewJavaException(
+      UnexpectedException::create("Event payload schema has " + std::to_string(size) + " field names, but " +
+                                  std::to_string(fieldTypes->size()) + " field types").get()
+    );
+  }
 
-    jsi::Value unpackedValue = jsWeakThis->lock(rt);
-    if (unpackedValue.isUndefined()) {
-      // The JS object was deallocated - we can ignore emitting an event
-      return;
+  auto rawTypes = fieldTypes->getRegion(0, static_cast<jsize>(size));
+  std::vector<EventPayloadSchema::FieldType> types;
+  types.reserve(size);
+  for (size_t i = 0; i < size; i++) {
+    auto rawType = rawTypes[i];
+    if (rawType < static_cast<jint>(EventPayloadSchema::FieldType::INT) ||
+        rawType > static_cast<jint>(EventPayloadSchema::FieldType::BOOLEAN)) {
+      throwNewJavaException(
+        UnexpectedException::create("Invalid type of the event payload field '" + names[i] + "': " + std::to_string(rawType)).get()
+      );
     }
+    types.push_back(static_cast<EventPayloadSchema::FieldType>(rawType));
+  }
+
+  return EventPayloadSchema::registerSchema(std::move(names), types);
+}
 
-    jsi::Object jsThis = unpackedValue.asObject(rt);
-    EventEmitter::emitEvent(rt, jsThis, name, argsProvider(rt));
-  });
+jint JNIUtils::internEventName(
+  [[maybe_unused]] jni::alias_ref<jni::JClass> clazz,
+  jni::alias_ref<jstring> eventName
+) {
+  return static_cast<jint>(EventEmitter::internEventName(eventName->toStdString()));
 }
 
 void JNIUtils::emitEventOnJSIObject(
-  std::weak_ptr<jsi::Object> jsiThis,
+  std::weak_ptr<jsi::WeakObject> jsiThis,
   jni::alias_ref<jni::HybridClass<JSIContext>::javaobject> jsiContextRef,
-  jni::alias_ref<jstring> eventName,
+  jint eventId,
   ArgsProvider argsProvider
 ) {
-  const std::string name = eventName->toStdString();
+  std::shared_ptr<jsi::WeakObject> target = jsiThis.lock();
+  if (!target) {
+    return;
+  }
 
   const JSIContext *jsiContext = jsiContextRef->cthis();
 
-  jsiContext->runtimeHolder->jsInvoker->invokeAsync([
-                                                      jsiContext,
-                                                      name = name,
-                                                      weakThis = std::move(jsiThis),
-                                                      argsProvider = std::move(argsProvider)
-                                                    ]() {
-    std::shared_ptr<jsi::Object> jsThis = weakThis.lock();
-    if (!jsThis) {
-      return;
-    }
+  jsiContext->eventQueue->enqueue(
+    target.get(),
+    static_cast<EventEmitter::EventId>(eventId),
+    [weakThis = std::move(jsiThis)](jsi::Runtime &rt) -> std::optional<jsi::Object> {
+      std::shared_ptr<jsi::WeakObject> jsWeakThis = weakThis.lock();
+      if (!jsWeakThis) {
+        return std::nullopt;
+      }
+
+      jsi::Value unpackedValue = jsWeakThis->lock(rt);
+      if (unpackedValue.isUndefined()) {
+        // The JS object was deallocated - we can ignore emitting an event
+        return std::nullopt;
+      }
+      return unpackedValue.asObject(rt);
+    },
+    std::move(argsProvider)
+  );
+}
+
+void JNIUtils::emitEventOnJSIObject(
+  std::weak_ptr<jsi::Object> jsiThis,
+  const void *emitter,
+  jni::alias_ref<jni::HybridClass<JSIContext>::javaobject> jsiContextRef,
+  jint eventId,
+  ArgsProvider argsProvider
+) {
+  if (jsiThis.expired()) {
+    return;
+  }
 
-    // TODO(@lukmccall): refactor when jsInvoker receives a runtime as a parameter
-    jsi::Runtime &rt = jsiContext->runtimeHolder->get();
+  const JSIContext *jsiContext = jsiContextRef->cthis();
 
-    EventEmitter::emitEvent(rt, *jsThis, name, argsProvider(rt));
-  });
+  jsiContext->eventQueue->enqueue(
+    emitter,
+    static_cast<EventEmitter::EventId>(eventId),
+    [weakThis = std::move(jsiThis)](jsi::Runtime &rt) -> std::optional<jsi::Object> {
+      std::shared_ptr<jsi::Object> jsThis = weakThis.lock();
+      if (!jsThis) {
+        return std::nullopt;
+      }
+      return jsi::Value(rt, *jsThis).getObject(rt);
+    },
+    std::move(argsProvider)
+  );
 }
 } // namespace expo
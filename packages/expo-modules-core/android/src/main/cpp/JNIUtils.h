@@ -10,6 +10,8 @@
 #include "JavaScriptWeakObject.h"
 #include "JSharedObject.h"
 
+#include <fbjni/ByteBuffer.h>
+
 namespace jni = facebook::jni;
 namespace jsi = facebook::jsi;
 namespace react = facebook::react;
@@ -35,7 +37,7 @@ public:
     jni::alias_ref<jni::JClass> clazz,
     jni::alias_ref<JavaScriptWeakObject::javaobject> jsiThis,
     jni::alias_ref<jni::HybridClass<JSIContext>::javaobject> jsiContextRef,
-    jni::alias_ref<jstring> eventName,
+    jint eventId,
     jni::alias_ref<jni::JArrayClass<jobject>> args
   );
 
@@ -43,7 +45,7 @@ public:
     jni::alias_ref<jni::JClass> clazz,
     jni::alias_ref<JavaScriptObject::javaobject> jsiThis,
     jni::alias_ref<jni::HybridClass<JSIContext>::javaobject> jsiContextRef,
-    jni::alias_ref<jstring> eventName,
+    jint eventId,
     jni::alias_ref<jni::JArrayClass<jobject>> args
   );
 
@@ -51,24 +53,52 @@ public:
     jni::alias_ref<jni::JClass> clazz,
     jni::alias_ref<JavaScriptModuleObject::javaobject> jsiThis,
     jni::alias_ref<jni::HybridClass<JSIContext>::javaobject> jsiContextRef,
-    jni::alias_ref<jstring> eventName,
+    jint eventId,
     jni::alias_ref<jni::JMap<jstring, jobject>> eventBody
   );
 
+  static void emitEventWithPayloadOnJavaScriptModule(
+    jni::alias_ref<jni::JClass> clazz,
+    jni::alias_ref<JavaScriptModuleObject::javaobject> jsiThis,
+    jni::alias_ref<jni::HybridClass<JSIContext>::javaobject> jsiContextRef,
+    jint eventId,
+    jint payloadSchemaId,
+    jni::alias_ref<jni::JByteBuffer> payload
+  );
+
+  static jint registerEventPayloadSchema(
+    jni::alias_ref<jni::JClass> clazz,
+    jni::alias_ref<jni::JArrayClass<jstring>> fieldNames,
+    jni::alias_ref<jni::JArrayInt> fieldTypes
+  );
+
+  /**
+   * Interns the event name and returns its ID, which is then passed to `emitEvent` instead of the name.
+   */
+  static jint internEventName(
+    jni::alias_ref<jni::JClass> clazz,
+    jni::alias_ref<jstring> eventName
+  );
+
 private:
   using ArgsProvider = std::function<std::vector<jsi::Value>(jsi::Runtime &rt)>;
 
+  /**
+   * Enqueues the event for the given JS object. The `emitter` pointer identifies the emitter when coalescing
+   * events and looking up their delivery policies, e.g. a module is identified by its `JavaScriptModuleObject`.
+   */
   static void emitEventOnJSIObject(
     std::weak_ptr<jsi::Object> jsiThis,
+    const void *emitter,
     jni::alias_ref<jni::HybridClass<JSIContext>::javaobject> jsiContextRef,
-    jni::alias_ref<jstring> eventName,
+    jint eventId,
     ArgsProvider argsProvider
   );
 
   static void emitEventOnJSIObject(
     std::weak_ptr<jsi::WeakObject> jsiThis,
     jni::alias_ref<jni::HybridClass<JSIContext>::javaobject> jsiContextRef,
-    jni::alias_ref<jstring> eventName,
+    jint eventId,
     ArgsProvider argsProvider
   );
 };
@@ -0,0 +1,107 @@
+// Copyright © 2026-present 650 Industries, Inc. (aka Expo)
+
+#include "JNIWorkerPool.h"
+
+#include <android/log.h>
+#include <future>
+#include <thread>
+
+namespace expo {
+
+namespace {
+
+JavaVM *javaVM = nullptr;
+
+} // namespace
+
+void JNIWorkerPool::initialize(JavaVM *vm) {
+  javaVM = vm;
+}
+
+JNIWorkerPool &JNIWorkerPool::shared() {
+  // The workers live as long as the process, so the pool is never destroyed.
+  static auto *pool = new JNIWorkerPool();
+  return *pool;
+}
+
+bool JNIWorkerPool::isCurrentThreadAttached() {
+  JNIEnv *env = nullptr;
+  return javaVM != nullptr && javaVM->GetEnv(reinterpret_cast<void **>(&env), JNI_VERSION_1_6) == JNI_OK;
+}
+
+void JNIWorkerPool::dispatch(std::function<void()> task) {
+  {
+    std::lock_guard lock(mutex);
+    startThreadsIfNeeded();
+    tasks.push_back(std::move(task));
+  }
+  condition.notify_one();
+}
+
+void JNIWorkerPool::runAttached(const std::function<void()> &task) {
+  if (isCurrentThreadAttached()) {
+    task();
+    return;
+  }
+
+  std::promise<void> done;
+  auto result = done.get_future();
+  dispatch([&task, &done] {
+    try {
+      task();
+      done.set_value();
+    } catch (...) {
+      done.set_exception(std::current_exception());
+    }
+  });
+  result.get();
+}
+
+void JNIWorkerPool::release(jobject globalRef) {
+  if (globalRef == nullptr) {
+    return;
+  }
+  if (isCurrentThreadAttached()) {
+    jni::Environment::current()->DeleteGlobalRef(globalRef);
+    return;
+  }
+  dispatch([globalRef] {
+    jni::Environment::current()->DeleteGlobalRef(globalRef);
+  });
+}
+
+void JNIWorkerPool::startThreadsIfNeeded() {
+  if (areThreadsStarted) {
+    return;
+  }
+  areThreadsStarted = true;
+  for (size_t i = 0; i < threadCount; i++) {
+    std::thread([this] {
+      jni::ThreadScope::WithClassLoader([this] {
+        runWorker();
+      });
+    }).detach();
+  }
+}
+
+void JNIWorkerPool::runWorker() {
+  for (;;) {
+    std::function<void()> task;
+    {
+      std::unique_lock lock(mutex);
+      condition.wait(lock, [this] { return !tasks.empty(); });
+      task = std::move(tasks.front());
+      tasks.pop_front();
+    }
+
+    try {
+      task();
+    } catch (const std::exception &exception) {
+      __android_log_print(ANDROID_LOG_ERROR, "ExpoModulesCore", "JNI worker task failed: %s", exception.what());
+    } catch (...) {
+      __android_log_print(ANDROID_LOG_ERROR, "ExpoModulesCore", "JNI worker task failed.");
+    }
+  }
+}
+
+} // namespace expo
@@ -0,0 +1,72 @@
+// Copyright © 2026-present 650 Industries, Inc. (aka Expo)
+
+#pragma once
+
+#include "ExpoHeader.pch"
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+
+namespace jni = facebook::jni;
+
+namespace expo {
+
+/**
+ * A small pool of threads that are attached to the JVM, with the app's class loader, once for their whole lifetime.
+ * JNI work coming from threads that are not attached, such as releasing references when native memory
+ * is freed on a GC or worker thread, is dispatched to these threads, so it never has to attach
+ * and detach the calling thread.
+ */
+class JNIWorkerPool {
+public:
+  /**
+   * Remembers the JVM, so it's possible to check if a thread is attached without attaching it.
+   * Has to be called once the library is loaded.
+   */
+  static void initialize(JavaVM *vm);
+
+  static JNIWorkerPool &shared();
+
+  /**
+   * Whether the current thread is attached to the JVM.
+   */
+  static bool isCurrentThreadAttached();
+
+  /**
+   * Runs the task on one of the worker threads.
+   */
+  void dispatch(std::function<void()> task);
+
+  /**
+   * Runs the task right away if the current thread is attached to the JVM. Otherwise, runs it on a worker thread
+   * and waits until it's done.
+   */
+  void runAttached(const std::function<void()> &task);
+
+  /**
+   * Deletes the global reference. It's deleted right away if the current thread is attached to the JVM
+   * or asynchronously on a worker thread otherwise.
+   */
+  void release(jobject globalRef);
+
+  template<typename T>
+  void release(jni::global_ref<T> &&ref) {
+    release(ref.release());
+  }
+
+private:
+  static constexpr size_t threadCount = 2;
+
+  std::mutex mutex;
+  std::condition_variable condition;
+  std::deque<std::function<void()>> tasks;
+  bool areThreadsStarted = false;
+
+  void startThreadsIfNeeded();
+
+  void runWorker();
+};
+
+} // namespace expo
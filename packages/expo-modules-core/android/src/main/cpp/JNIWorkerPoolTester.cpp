@@ -0,0 +1,89 @@
+// Copyright © 2026-present 650 Industries, Inc. (aka Expo)
+
+#include "JNIWorkerPoolTester.h"
+#include "JNIWorkerPool.h"
+
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+namespace expo {
+
+void JNIWorkerPoolTester::registerNatives() {
+  javaClassStatic()->registerNatives({
+                                       makeNativeMethod("runAttachedOnAttachedThread",
+                                                        JNIWorkerPoolTester::runAttachedOnAttachedThread),
+                                       makeNativeMethod("runAttachedOnDetachedThread",
+                                                        JNIWorkerPoolTester::runAttachedOnDetachedThread),
+                                       makeNativeMethod("runFailingTaskOnDetachedThread",
+                                                        JNIWorkerPoolTester::runFailingTaskOnDetachedThread),
+                                       makeNativeMethod("releaseOnDetachedThread",
+                                                        JNIWorkerPoolTester::releaseOnDetachedThread)
+                                     });
+}
+
+jboolean JNIWorkerPoolTester::runAttachedOnAttachedThread(jni::alias_ref<jni::JClass> clazz) {
+  const auto callerThreadId = std::this_thread::get_id();
+  std::thread::id taskThreadId;
+
+  JNIWorkerPool::shared().runAttached([&taskThreadId] {
+    taskThreadId = std::this_thread::get_id();
+  });
+  return taskThreadId == callerThreadId;
+}
+
+jboolean JNIWorkerPoolTester::runAttachedOnDetachedThread(jni::alias_ref<jni::JClass> clazz) {
+  bool result = false;
+
+  std::thread([&result] {
+    const bool isCallerAttached = JNIWorkerPool::isCurrentThreadAttached();
+    const auto callerThreadId = std::this_thread::get_id();
+    bool isTaskThreadAttached = false;
+    std::thread::id taskThreadId;
+
+    JNIWorkerPool::shared().runAttached([&isTaskThreadAttached, &taskThreadId] {
+      isTaskThreadAttached = JNIWorkerPool::isCurrentThreadAttached();
+      taskThreadId = std::this_thread::get_id();
+    });
+    result = !isCallerAttached && isTaskThreadAttached && taskThreadId != callerThreadId;
+  }).join();
+
+  return result;
+}
+
+jni::local_ref<jstring> JNIWorkerPoolTester::runFailingTaskOnDetachedThread(
+  jni::alias_ref<jni::JClass> clazz,
+  jni::alias_ref<jstring> message
+) {
+  const std::string errorMessage = message->toStdString();
+  std::optional<std::string> rethrownMessage;
+
+  std::thread([&errorMessage, &rethrownMessage] {
+    try {
+      JNIWorkerPool::shared().runAttached([&errorMessage] {
+        throw std::runtime_error(errorMessage);
+      });
+    } catch (const std::exception &exception) {
+      rethrownMessage = exception.what();
+    }
+  }).join();
+
+  if (!rethrownMessage) {
+    return nullptr;
+  }
+  return jni::make_jstring(*rethrownMessage);
+}
+
+void JNIWorkerPoolTester::releaseOnDetachedThread(
+  jni::alias_ref<jni::JClass> clazz,
+  jni::alias_ref<jobject> object
+) {
+  jobject globalRef = jni::Environment::current()->NewGlobalRef(object.get());
+
+  std::thread([globalRef] {
+    JNIWorkerPool::shared().release(globalRef);
+  }).join();
+}
+
+} // namespace expo
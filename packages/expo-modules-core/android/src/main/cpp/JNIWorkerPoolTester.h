@@ -0,0 +1,52 @@
+// Copyright © 2026-present 650 Industries, Inc. (aka Expo)
+
+#pragma once
+
+#include "ExpoHeader.pch"
+
+namespace jni = facebook::jni;
+
+namespace expo {
+
+/**
+ * Exposes the `JNIWorkerPool` to the instrumented tests. Threads created by the JVM are always attached,
+ * so the functions start native threads that are not attached and use the pool from there.
+ */
+class JNIWorkerPoolTester : public jni::JavaClass<JNIWorkerPoolTester> {
+public:
+  static auto constexpr kJavaDescriptor = "Lexpo/modules/kotlin/jni/tests/JNIWorkerPoolTester;";
+  static auto constexpr TAG = "JNIWorkerPoolTester";
+
+  static void registerNatives();
+
+  /**
+   * Calls `runAttached` on the current, attached thread.
+   * @return whether the task was run right away on the same thread
+   */
+  static jboolean runAttachedOnAttachedThread(jni::alias_ref<jni::JClass> clazz);
+
+  /**
+   * Calls `runAttached` on a thread that isn't attached to the JVM.
+   * @return whether the task was run on another thread that was attached
+   */
+  static jboolean runAttachedOnDetachedThread(jni::alias_ref<jni::JClass> clazz);
+
+  /**
+   * Calls `runAttached` with a task throwing an error with the given message on a thread that isn't attached.
+   * @return the message of the error rethrown by `runAttached` or `null` if nothing was rethrown
+   */
+  static jni::local_ref<jstring> runFailingTaskOnDetachedThread(
+    jni::alias_ref<jni::JClass> clazz,
+    jni::alias_ref<jstring> message
+  );
+
+  /**
+   * Creates a global reference to the object and releases it on a thread that isn't attached.
+   */
+  static void releaseOnDetachedThread(
+    jni::alias_ref<jni::JClass> clazz,
+    jni::alias_ref<jobject> object
+  );
+};
+
+} // namespace expo
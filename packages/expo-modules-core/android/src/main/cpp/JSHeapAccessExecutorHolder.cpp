@@ -1,4 +1,5 @@
 #include "JSHeapAccessExecutorHolder.h"
+#include "JNIWorkerPool.h"
 
 #include <fbjni/NativeRunnable.h>
 
@@ -41,7 +42,7 @@ JSHeapAccessExecutorHolder::JSHeapAccessExecutorHolder(jni::alias_ref<jni::JObje
   : _executor(jni::make_global(executor)) {}
 
 JSHeapAccessExecutorHolder::~JSHeapAccessExecutorHolder() {
-  jni::ThreadScope::WithClassLoader([&] { _executor.reset(); });
+  JNIWorkerPool::shared().release(std::move(_executor));
 }
 
 void JSHeapAccessExecutorHolder::runSync(std::function<void()> body) {
@@ -6,12 +6,15 @@
 #include "JavaReferencesCache.h"
 #include "JSReferencesCache.h"
 #include "JSIUtils.h"
+#include "JNIWorkerPool.h"
 #include "SharedObject.h"
 #include "decorators/JSDecoratorsBridgingObject.h"
 #include "decorators/JSClassesDecorator.h"
 
 #include <fbjni/detail/Meta.h>
+#include <android/log.h>
 
+#include <atomic>
 #include <shared_mutex>
 
 namespace jni = facebook::jni;
@@ -27,8 +30,21 @@ void JSIContext::registerNatives() {
                    makeNativeMethod("createObject", JSIContext::createObject),
                    makeNativeMethod("scheduleOnJSThread", JSIContext::scheduleOnJSThread),
                    makeNativeMethod("drainJSEventLoop", JSIContext::drainJSEventLoop),
+                   makeNativeMethod("onModulesChangedNative", JSIContext::onModulesChanged),
+                   makeNativeMethod("detachJSIHandlesNative", JSIContext::detachJSIHandles),
+                   makeNativeMethod("setEventDeliveryPolicy", JSIContext::setEventDeliveryPolicy),
+                   makeNativeMethod("setModuleEventDeliveryPolicy", JSIContext::setModuleEventDeliveryPolicy),
+                   makeNativeMethod("setWeakObjectEventDeliveryPolicy", JSIContext::setWeakObjectEventDeliveryPolicy),
                    makeNativeMethod("setNativeStateForSharedObject",
                                     JSIContext::jniSetNativeStateForSharedObject),
+                   makeNativeMethod("wasSharedObjectReleased",
+                                    JSIContext::jniWasSharedObjectReleased),
+                   makeNativeMethod("getLiveSharedObjectsCount",
+                                    JSIContext::jniGetLiveSharedObjectsCount),
+                   makeNativeMethod("getPeakSharedObjectsCount",
+                                    JSIContext::jniGetPeakSharedObjectsCount),
+                   makeNativeMethod("getJSIHandlesCount",
+                                    JSIContext::jniGetJSIHandlesCount),
                    makeNativeMethod("installModuleClasses",
                                     JSIContext::installModuleClasses),
                  });
@@ -46,6 +62,18 @@ JSIContext::JSIContext(
     runtime,
     std::move(callInvoker)
   );
+
+  eventQueue = std::make_shared<EventEmitter::EventQueue>(
+    [jsInvoker = runtimeHolder->jsInvoker](std::function<void(jsi::Runtime &)> &&task) {
+      jsInvoker->invokeAsync(std::move(task));
+    }
+  );
+
+  promiseSettlementQueue = std::make_shared<PromiseSettlementQueue>(
+    [jsInvoker = runtimeHolder->jsInvoker](std::function<void(jsi::Runtime &)> &&task) {
+      jsInvoker->invokeAsync(std::move(task));
+    }
+  );
 }
 
 jni::local_ref<JSIContext::javaobject> JSIContext::newJavaInstance(
@@ -65,6 +93,38 @@ void JSIContext::bindToJavaPart(
   threadSafeJThis = std::make_shared<ThreadSafeJNIGlobalRef<JSIContext::javaobject>>(
     jni::Environment::current()->NewGlobalRef(javaPart_.get())
   );
+  sharedObjectReleaseQueue = std::make_shared<SharedObject::ReleaseQueue>(
+    // We can't predict the order of deallocation of the JSIContext and the SharedObject.
+    // So we need to pass a new ref to retain the JSIContext to make sure it's not deallocated before the SharedObject.
+    [threadSafeRef = threadSafeJThis](const std::vector<SharedObject::ObjectId> &objectIds) {
+      if (threadSafeRef == nullptr) {
+        return;
+      }
+      threadSafeRef->use([&objectIds](jni::alias_ref<JSIContext::javaobject> globalRef) {
+        // `use` can't throw and the queue may be flushed during teardown, so errors thrown by Kotlin are only logged.
+        try {
+          JSIContext::deleteSharedObjects(globalRef, objectIds);
+        } catch (const std::exception &exception) {
+          __android_log_print(ANDROID_LOG_ERROR, "ExpoModulesCore", "Cannot delete released shared objects: %s", exception.what());
+        }
+      });
+    },
+    // Collected objects are released on a thread attached to the JVM, never on the thread running the garbage collector.
+    [](std::function<void()> &&task) {
+      JNIWorkerPool::shared().dispatch(std::move(task));
+    }
+  );
+  sharedObjectRegistry = std::make_shared<SharedObject::Registry>(
+    // Objects released explicitly with `release()` are deleted right away, on the JS thread.
+    [threadSafeRef = threadSafeJThis](const SharedObject::ObjectId objectId) {
+      threadSafeRef->use([objectId](jni::alias_ref<JSIContext::javaobject> globalRef) {
+        JSIContext::deleteSharedObject(globalRef, objectId);
+      });
+    },
+    [releaseQueue = sharedObjectReleaseQueue](const SharedObject::ObjectId objectId) {
+      releaseQueue->enqueue(objectId);
+    }
+  );
 }
 
 jni::local_ref<JavaScriptModuleObject::javaobject>
@@ -132,6 +192,18 @@ jni::local_ref<jni::JArrayClass<jni::JString>> JSIContext::getModulesName() cons
   return callGetJavaScriptModulesNames();
 }
 
+void JSIContext::onModulesChanged() noexcept {
+  modulesVersion.fetch_add(1, std::memory_order_release);
+}
+
+void JSIContext::detachJSIHandles() noexcept {
+  jsiHandles->detachAll();
+}
+
+uint32_t JSIContext::getModulesVersion() const noexcept {
+  return modulesVersion.load(std::memory_order_acquire);
+}
+
 jni::local_ref<JavaScriptValue::javaobject> JSIContext::evaluateScript(
   jni::JString script
 ) {
@@ -163,6 +235,67 @@ void JSIContext::drainJSEventLoop() {
   runtimeHolder->drainJSEventLoop();
 }
 
+namespace {
+
+EventEmitter::DeliveryPolicy makeDeliveryPolicy(int mode, jlong sampleIntervalMs) {
+  if (mode < static_cast<int>(EventEmitter::DeliveryPolicy::Mode::All) ||
+      mode > static_cast<int>(EventEmitter::DeliveryPolicy::Mode::Sample)) {
+    throwNewJavaException(
+      UnexpectedException::create("Unknown event delivery policy: " + std::to_string(mode)).get()
+    );
+  }
+  if (sampleIntervalMs < 0) {
+    throwNewJavaException(
+      UnexpectedException::create("Event sample interval cannot be negative.").get()
+    );
+  }
+  return EventEmitter::DeliveryPolicy {
+    .mode = static_cast<EventEmitter::DeliveryPolicy::Mode>(mode),
+    .sampleInterval = std::chrono::milliseconds(sampleIntervalMs)
+  };
+}
+
+} // namespace
+
+void JSIContext::setEventDeliveryPolicy(
+  jint eventId,
+  int mode,
+  jlong sampleIntervalMs
+) {
+  eventQueue->setPolicy(
+    nullptr,
+    static_cast<EventEmitter::EventId>(eventId),
+    makeDeliveryPolicy(mode, sampleIntervalMs)
+  );
+}
+
+void JSIContext::setModuleEventDeliveryPolicy(
+  jni::alias_ref<JavaScriptModuleObject::javaobject> module,
+  jint eventId,
+  int mode,
+  jlong sampleIntervalMs
+) {
+  // Modules emit events identified by their `JavaScriptModuleObject`, see `JNIUtils::emitEventOnJavaScriptModule`.
+  eventQueue->setPolicy(
+    module->cthis(),
+    static_cast<EventEmitter::EventId>(eventId),
+    makeDeliveryPolicy(mode, sampleIntervalMs)
+  );
+}
+
+void JSIContext::setWeakObjectEventDeliveryPolicy(
+  jni::alias_ref<JavaScriptWeakObject::javaobject> object,
+  jint eventId,
+  int mode,
+  jlong sampleIntervalMs
+) {
+  eventQueue->setPolicy(
+    object->cthis()->getWeak().get(),
+    static_cast<EventEmitter::EventId>(eventId),
+    makeDeliveryPolicy(mode, sampleIntervalMs)
+  );
+}
+
 void JSIContext::registerSharedObject(
   jni::local_ref<jobject> native,
   jni::local_ref<JavaScriptObject::javaobject> js
@@ -208,6 +341,26 @@ void JSIContext::deleteSharedObject(
   method(javaObject, objectId);
 }
 
+void JSIContext::deleteSharedObjects(
+  jni::alias_ref<JSIContext::javaobject> javaObject,
+  const std::vector<SharedObject::ObjectId> &objectIds
+) {
+  if (javaObject == nullptr) {
+    throw std::runtime_error("deleteSharedObjects: JSIContext is invalid.");
+  }
+
+  // IDs are stored as `long`, so they need to be narrowed down to Java's `int`.
+  std::vector<jint> ids(objectIds.begin(), objectIds.end());
+  auto jIds = jni::JArrayInt::newArray(static_cast<jsize>(ids.size()));
+  jIds->setRegion(0, static_cast<jsize>(ids.size()), ids.data());
+
+  const static auto method = expo::JSIContext::javaClassLocal()
+    ->getMethod<void(jni::alias_ref<jni::JArrayInt>)>(
+      "deleteSharedObjects"
+    );
+  method(javaObject, jIds);
+}
+
 void JSIContext::registerClass(
   jni::local_ref<jclass> native,
   jni::local_ref<JavaScriptObject::javaobject> jsClass
@@ -268,16 +421,18 @@ jsi::Value JSIContext::resolveSharedObjectInstance(jsi::Runtime &rt, int objectI
   }
 
   auto protoObj = proto.asObject(rt);
-  auto instance = common::createObjectWithPrototype(rt, &protoObj);
 
   // Flags = 0 → non-configurable, non-enumerable, non-writable. Freezes the id on the proxy.
   // Unlike the main-runtime path (SharedObject.cpp) which defines __expo_shared_object_id__
   // as a getter on the prototype reading NativeState, here it's an own property on the instance
   // since worklet proxies don't carry NativeState. SharedObjectIdConverter uses getProperty
   // which finds own props first, so both paths resolve correctly.
+  // The id is defined by `Object.create` itself, so creating a proxy takes a single call into JS.
   jsi::Object descriptor = JavaScriptObject::preparePropertyDescriptor(rt, 0);
   descriptor.setProperty(rt, "value", objectId);
-  common::defineProperty(rt, &instance, "__expo_shared_object_id__", std::move(descriptor));
+  jsi::Object descriptors(rt);
+  descriptors.setProperty(rt, "__expo_shared_object_id__", std::move(descriptor));
+  auto instance = common::createObjectWithPrototype(rt, &protoObj, std::move(descriptors));
 
   return jsi::Value(rt, std::move(instance));
 }
@@ -327,35 +482,61 @@ void JSIContext::installModuleClasses() {
 }
 
 void JSIContext::prepareForDeallocation() noexcept {
+  // Release JS values held by the Kotlin wrappers while the runtime still exists.
+  jsiHandles->detachAll();
   jsRegistry.reset();
   if (runtimeHolder) {
     unbindJSIContext(runtimeHolder->get());
     runtimeHolder.reset();
   }
   jsHeapAccessExecutor.reset();
+  // Keep the queues themselves, so events and results delivered from other threads in the meantime are just ignored.
+  if (eventQueue) {
+    eventQueue->invalidate();
+  }
+  if (promiseSettlementQueue) {
+    promiseSettlementQueue->invalidate();
+  }
+  // Deliver pending releases now. Objects released later, e.g. when the runtime is destroyed, are still delivered by the workers.
+  // The queue doesn't exist if the context was never bound to its Kotlin part.
+  if (sharedObjectReleaseQueue) {
+    try {
+      sharedObjectReleaseQueue->flush();
+    } catch (const std::exception &exception) {
+      __android_log_print(ANDROID_LOG_ERROR, "ExpoModulesCore", "Cannot flush released shared objects: %s", exception.what());
+    }
+  }
   jniDeallocator.reset();
   wasDeallocated_ = true;
 }
 
-void JSIContext::jniSetNativeStateForSharedObject(
-  int id,
+int JSIContext::jniSetNativeStateForSharedObject(
   jni::alias_ref<JavaScriptObject::javaobject> jsObject
-) noexcept {
-  auto nativeState = std::make_shared<expo::SharedObject::NativeState>(
-    id,
-    // We can't predict the order of deallocation of the JSIContext and the SharedObject.
-    // So we need to pass a new ref to retain the JSIContext to make sure it's not deallocated before the SharedObject.
-    [threadSafeRef = threadSafeJThis](const SharedObject::ObjectId objectId) {
-      threadSafeRef->use([objectId](jni::alias_ref<JSIContext::javaobject> globalRef) {
-        JSIContext::deleteSharedObject(globalRef, objectId);
-      });
-    }
-  );
+) {
+  auto nativeState = sharedObjectRegistry->createNativeState();
+  auto objectId = nativeState->objectId;
 
   jsObject
     ->cthis()
     ->get()
     ->setNativeState(runtimeHolder->get(), std::move(nativeState));
+  return static_cast<int>(objectId);
+}
+
+bool JSIContext::jniWasSharedObjectReleased(int id) const noexcept {
+  return sharedObjectRegistry->wasReleased(id);
+}
+
+int JSIContext::jniGetLiveSharedObjectsCount() const noexcept {
+  return static_cast<int>(sharedObjectRegistry->getStats().live);
+}
+
+int JSIContext::jniGetPeakSharedObjectsCount() const noexcept {
+  return static_cast<int>(sharedObjectRegistry->getStats().peak);
+}
+
+int JSIContext::jniGetJSIHandlesCount() const noexcept {
+  return static_cast<int>(jsiHandles->size());
 }
 
 bool JSIContext::wasDeallocated() const noexcept {
@@ -365,22 +546,55 @@ bool JSIContext::wasDeallocated() const noexcept {
 static std::unordered_map<uintptr_t, JSIContext *> jsiContexts;
 static std::shared_mutex jsiContextsMutex;
 
+/**
+ * Incremented whenever a context is bound or unbound. Modified only with the exclusive lock held.
+ */
+static std::atomic<uint64_t> jsiContextsGeneration{0};
+
+/**
+ * The context that was most recently looked up on the current thread. It's valid only as long as
+ * the generation doesn't change, so it can't outlive the binding even if the runtime address is reused.
+ */
+struct LastJSIContextLookup {
+  uintptr_t runtime = 0;
+  JSIContext *jsiContext = nullptr;
+  uint64_t generation = UINT64_MAX;
+};
+
+static thread_local LastJSIContextLookup lastJSIContextLookup;
+
 void bindJSIContext(const jsi::Runtime &runtime, JSIContext *jsiContext) {
   std::unique_lock lock(jsiContextsMutex);
   jsiContexts[reinterpret_cast<uintptr_t>(&runtime)] = jsiContext;
+  jsiContextsGeneration.fetch_add(1, std::memory_order_release);
 }
 
 void unbindJSIContext(const jsi::Runtime &runtime) {
   std::unique_lock lock(jsiContextsMutex);
   jsiContexts.erase(reinterpret_cast<uintptr_t>(&runtime));
+  jsiContextsGeneration.fetch_add(1, std::memory_order_release);
 }
 
 JSIContext *getJSIContext(const jsi::Runtime &runtime) {
+  const auto runtimeAddress = reinterpret_cast<uintptr_t>(&runtime);
+  auto &lastLookup = lastJSIContextLookup;
+  // Runtimes are usually accessed from the same thread, so most lookups end here without taking the lock.
+  if (lastLookup.runtime == runtimeAddress
+      && lastLookup.generation == jsiContextsGeneration.load(std::memory_order_acquire)) {
+    return lastLookup.jsiContext;
+  }
+
   std::shared_lock lock(jsiContextsMutex);
-  const auto iterator = jsiContexts.find(reinterpret_cast<uintptr_t>(&runtime));
+  const auto iterator = jsiContexts.find(runtimeAddress);
   if (iterator == jsiContexts.end()) {
     throw std::invalid_argument("JSIContext for the given runtime doesn't exist");
   }
+  lastLookup = {
+    .runtime = runtimeAddress,
+    .jsiContext = iterator->second,
+    // The generation can't change while the lock is held.
+    .generation = jsiContextsGeneration.load(std::memory_order_relaxed)
+  };
   return iterator->second;
 }
 
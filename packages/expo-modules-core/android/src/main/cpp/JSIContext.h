@@ -7,13 +7,21 @@
 #include "JavaScriptModuleObject.h"
 #include "JavaScriptValue.h"
 #include "JavaScriptObject.h"
+#include "JavaScriptWeakObject.h"
 #include "JSReferencesCache.h"
 #include "JNIDeallocator.h"
+#include "JSIHandle.h"
 #include "ThreadSafeJNIGlobalRef.h"
+#include "EventQueue.h"
+#include "PromiseSettlementQueue.h"
+#include "SharedObjectRegistry.h"
+#include "SharedObjectReleaseQueue.h"
 #include "javaclasses/JSRunnable.h"
 
 #include <ReactCommon/CallInvoker.h>
 
+#include <atomic>
+
 namespace jni = facebook::jni;
 namespace jsi = facebook::jsi;
 namespace react = facebook::react;
@@ -62,6 +70,22 @@ public:
    */
   [[nodiscard]] jni::local_ref<jni::JArrayClass<jni::JString>> getModulesName() const;
 
+  /**
+   * Called by the Kotlin part after modules were registered or removed.
+   * The native module table is then reloaded on next access. Thread-safe.
+   */
+  void onModulesChanged() noexcept;
+
+  /**
+   * Returns a number that changes whenever modules are registered or removed.
+   */
+  [[nodiscard]] uint32_t getModulesVersion() const noexcept;
+
+  /**
+   * Detaches all wrappers of JS values created in this runtime. Called by the Kotlin part when the runtime is deallocated.
+   */
+  void detachJSIHandles() noexcept;
+
   /**
    * Exposes a `JavaScriptRuntime::evaluateScript` function to Kotlin
    */
@@ -103,6 +127,14 @@ public:
     int objectId
   );
 
+  /**
+   * Removes the batch of shared objects from the internal registry with a single JNI call.
+   */
+  static void deleteSharedObjects(
+    jni::alias_ref<JSIContext::javaobject> javaObject,
+    const std::vector<SharedObject::ObjectId> &objectIds
+  );
+
   /**
    * Schedules a lambda to run on the JS thread via the RuntimeScheduler.
    */
@@ -113,10 +145,58 @@ public:
    */
   void drainJSEventLoop();
 
+  /**
+   * Sets how events with the given name are delivered from the native event queue,
+   * for all emitters that don't have their own policy for this event.
+   * @param mode raw value of the `EventEmitter::DeliveryPolicy::Mode`, other values throw
+   */
+  void setEventDeliveryPolicy(jint eventId, int mode, jlong sampleIntervalMs);
+
+  /**
+   * Sets how events with the given name emitted by the given module are delivered.
+   */
+  void setModuleEventDeliveryPolicy(
+    jni::alias_ref<JavaScriptModuleObject::javaobject> module,
+    jint eventId,
+    int mode,
+    jlong sampleIntervalMs
+  );
+
+  /**
+   * Sets how events with the given name emitted to the given object, e.g. by a shared object, are delivered.
+   */
+  void setWeakObjectEventDeliveryPolicy(
+    jni::alias_ref<JavaScriptWeakObject::javaobject> object,
+    jint eventId,
+    int mode,
+    jlong sampleIntervalMs
+  );
+
   std::shared_ptr<JavaScriptRuntime> runtimeHolder;
   std::unique_ptr<JSReferencesCache> jsRegistry;
   jni::global_ref<JNIDeallocator::javaobject> jniDeallocator;
+  /**
+   * Table of the wrappers of JS values created in this runtime, like `JavaScriptObject`.
+   * They are detached from the runtime all at once when it's torn down.
+   */
+  std::shared_ptr<JSIHandleTable> jsiHandles = std::make_shared<JSIHandleTable>();
   std::shared_ptr<JSHeapAccessExecutorHolder> jsHeapAccessExecutor;
+  /**
+   * Queue batching events emitted from native code into a single JS task.
+   */
+  std::shared_ptr<EventEmitter::EventQueue> eventQueue;
+  /**
+   * Queue batching settlements of the promises returned by asynchronous functions into a single JS task.
+   */
+  std::shared_ptr<PromiseSettlementQueue> promiseSettlementQueue;
+  /**
+   * Registry assigning IDs to the shared objects created in this runtime.
+   */
+  std::shared_ptr<SharedObject::Registry> sharedObjectRegistry;
+  /**
+   * Queue collecting garbage-collected shared objects to remove them from the Kotlin registry in batches on a JNI worker.
+   */
+  std::shared_ptr<SharedObject::ReleaseQueue> sharedObjectReleaseQueue;
 
   void registerClass(jni::local_ref<jclass> native,
                      jni::local_ref<JavaScriptObject::javaobject> jsClass);
@@ -146,6 +226,8 @@ private:
 
   bool wasDeallocated_ = false;
 
+  std::atomic<uint32_t> modulesVersion = 0;
+
   jni::local_ref<JavaScriptObject::javaobject> ensureClassInstalled(jsi::Runtime &rt, jni::local_ref<jclass> nativeClass);
   jsi::Value resolveSharedObjectInstance(jsi::Runtime &rt, int objectId, jni::local_ref<JavaScriptObject::javaobject> jsClassObj);
 
@@ -164,10 +246,21 @@ private:
 
   void prepareRuntime() noexcept;
 
-  void jniSetNativeStateForSharedObject(
-    int id,
+  /**
+   * Registers the shared object in the native registry and attaches its native state to the JS object.
+   * @return ID assigned to the shared object
+   */
+  int jniSetNativeStateForSharedObject(
     jni::alias_ref<JavaScriptObject::javaobject> jsObject
-  ) noexcept;
+  );
+
+  bool jniWasSharedObjectReleased(int id) const noexcept;
+
+  int jniGetLiveSharedObjectsCount() const noexcept;
+
+  int jniGetPeakSharedObjectsCount() const noexcept;
+
+  int jniGetJSIHandlesCount() const noexcept;
 };
 
 /**
@@ -187,7 +280,8 @@ void unbindJSIContext(const jsi::Runtime &runtime);
 
 /**
  * Gets the JSIContext for the given runtime.
- * Thread-safe: uses exclusive lock.
+ * Thread-safe: repeated lookups of the same runtime on a thread don't take the lock,
+ * otherwise uses shared lock.
  * @param runtime
  * @return JSIContext * - it should never be stored when received from this function.
  * @throws std::invalid_argument if the JSIContext for the given runtime doesn't exist.
@@ -0,0 +1,83 @@
+// Copyright © 2026-present 650 Industries, Inc. (aka Expo)
+
+#include "JSIHandle.h"
+#include "Exceptions.h"
+#include "JavaScriptRuntime.h"
+
+namespace expo {
+
+namespace {
+
+[[noreturn]] void throwDetachedException() {
+  jni::throwNewJavaException(
+    UnexpectedException::create("The JS value was used after its runtime had been deallocated").get()
+  );
+}
+
+} // namespace
+
+JSIHandle::~JSIHandle() {
+  removeFromTable();
+}
+
+bool JSIHandle::isAttached() const noexcept {
+  return attached.load(std::memory_order_acquire);
+}
+
+std::shared_ptr<JavaScriptRuntime> JSIHandle::lockRuntime(
+  const std::weak_ptr<JavaScriptRuntime> &runtime
+) const {
+  ensureAttached();
+  auto lockedRuntime = runtime.lock();
+  if (lockedRuntime == nullptr) {
+    throwDetachedException();
+  }
+  return lockedRuntime;
+}
+
+void JSIHandle::ensureAttached() const {
+  if (!isAttached()) {
+    throwDetachedException();
+  }
+}
+
+void JSIHandle::removeFromTable() noexcept {
+  if (auto handleTable = table.lock()) {
+    handleTable->remove(this);
+    table.reset();
+  }
+}
+
+void JSIHandleTable::add(JSIHandle *handle) {
+  handle->table = weak_from_this();
+
+  std::lock_guard<std::mutex> lock(mutex);
+  if (isDetached) {
+    handle->attached.store(false, std::memory_order_release);
+    handle->detach();
+    return;
+  }
+  handles.insert(handle);
+}
+
+void JSIHandleTable::remove(JSIHandle *handle) noexcept {
+  std::lock_guard<std::mutex> lock(mutex);
+  handles.erase(handle);
+}
+
+void JSIHandleTable::detachAll() noexcept {
+  std::lock_guard<std::mutex> lock(mutex);
+  isDetached = true;
+  for (auto handle: handles) {
+    handle->attached.store(false, std::memory_order_release);
+    handle->detach();
+  }
+  handles.clear();
+}
+
+size_t JSIHandleTable::size() const noexcept {
+  std::lock_guard<std::mutex> lock(mutex);
+  return handles.size();
+}
+
+} // namespace expo
@@ -0,0 +1,98 @@
+// Copyright © 2026-present 650 Industries, Inc. (aka Expo)
+
+#pragma once
+
+#include "ExpoHeader.pch"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <unordered_set>
+
+namespace expo {
+
+class JavaScriptRuntime;
+
+class JSIHandleTable;
+
+/**
+ * A native part of a Kotlin wrapper that holds a JS value, like `JavaScriptObject` or `JavaScriptValue`.
+ * Handles are registered in the `JSIHandleTable` of the runtime they come from, so they can release
+ * their JS values when the runtime is torn down without registering each wrapper in the `JNIDeallocator`.
+ */
+class JSIHandle {
+public:
+  JSIHandle() = default;
+
+  virtual ~JSIHandle();
+
+  JSIHandle(const JSIHandle &) = delete;
+
+  JSIHandle &operator=(const JSIHandle &) = delete;
+
+  /**
+   * Releases the JS values held by the handle. Called once, when the runtime is torn down.
+   * After that, the wrapper throws when it's used.
+   */
+  virtual void detach() noexcept = 0;
+
+  /**
+   * @return whether the handle still holds its JS value.
+   */
+  [[nodiscard]] bool isAttached() const noexcept;
+
+  /**
+   * Locks the runtime the handle comes from.
+   * Throws `UnexpectedException` if the handle was detached or the runtime doesn't exist anymore.
+   */
+  std::shared_ptr<JavaScriptRuntime> lockRuntime(const std::weak_ptr<JavaScriptRuntime> &runtime) const;
+
+protected:
+  /**
+   * Throws `UnexpectedException` if the handle was detached.
+   */
+  void ensureAttached() const;
+
+  /**
+   * Unregisters the handle from its table. Destructors of the classes overriding `detach`
+   * have to call it first, so the table can't detach a partially destroyed handle.
+   */
+  void removeFromTable() noexcept;
+
+private:
+  friend class JSIHandleTable;
+
+  std::weak_ptr<JSIHandleTable> table;
+  std::atomic<bool> attached = true;
+};
+
+/**
+ * Keeps track of the handles created in a single runtime and detaches all of them at once at teardown.
+ * Registering a handle costs a hash set insertion under an uncontended lock, no JNI calls are made.
+ */
+class JSIHandleTable : public std::enable_shared_from_this<JSIHandleTable> {
+public:
+  /**
+   * Registers the handle in the table. If the table was already detached, the handle is detached right away.
+   */
+  void add(JSIHandle *handle);
+
+  void remove(JSIHandle *handle) noexcept;
+
+  /**
+   * Detaches all registered handles and the ones registered later.
+   */
+  void detachAll() noexcept;
+
+  /**
+   * @return the number of registered handles.
+   */
+  [[nodiscard]] size_t size() const noexcept;
+
+private:
+  mutable std::mutex mutex;
+  std::unordered_set<JSIHandle *> handles;
+  bool isDetached = false;
+};
+
+} // namespace expo
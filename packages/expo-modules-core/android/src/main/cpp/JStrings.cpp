@@ -0,0 +1,33 @@
+// Copyright © 2026-present 650 Industries, Inc. (aka Expo)
+
+#include "JStrings.h"
+
+namespace expo {
+
+jstring JStringInternCache::obtain(JNIEnv *env, const std::u16string &value) {
+  if (value.size() > maxLength) {
+    return newJString(env, value);
+  }
+
+  std::lock_guard<std::mutex> lock(mutex);
+  auto it = strings.find(value);
+  if (it != strings.end()) {
+    return static_cast<jstring>(env->NewLocalRef(it->second));
+  }
+
+  jstring string = newJString(env, value);
+  if (string != nullptr && strings.size() < capacity) {
+    strings.emplace(value, static_cast<jstring>(env->NewGlobalRef(string)));
+  }
+  return string;
+}
+
+void JStringInternCache::unLoad(JNIEnv *env) {
+  std::lock_guard<std::mutex> lock(mutex);
+  for (auto &[_, string]: strings) {
+    env->DeleteGlobalRef(string);
+  }
+  strings.clear();
+}
+
+} // namespace expo
@@ -0,0 +1,59 @@
+// Copyright © 2026-present 650 Industries, Inc. (aka Expo)
+
+#pragma once
+
+#include "ExpoHeader.pch"
+
+#include <mutex>
+#include <string>
+
+namespace expo {
+
+/**
+ * A bounded cache of Java strings created from short, frequently repeated values
+ * like enum cases, so each of them is backed by a single global `jstring`.
+ * Once the cache is full, new values are no longer interned.
+ */
+class JStringInternCache {
+public:
+  /**
+   * The maximum length (in UTF-16 code units) of strings that are interned.
+   */
+  static constexpr size_t maxLength = 32;
+
+  /**
+   * The maximum number of interned strings.
+   */
+  static constexpr size_t capacity = 512;
+
+  /**
+   * Returns a new local reference to the Java string with the given content.
+   */
+  jstring obtain(JNIEnv *env, const std::u16string &value);
+
+  void unLoad(JNIEnv *env);
+
+private:
+  std::mutex mutex;
+  std::unordered_map<std::u16string, jstring> strings;
+};
+
+/**
+ * Creates a Java string directly from UTF-16 code units.
+ */
+inline jstring newJString(JNIEnv *env, const std::u16string &value) {
+  return env->NewString(reinterpret_cast<const jchar *>(value.data()), static_cast<jsize>(value.size()));
+}
+
+/**
+ * Copies UTF-16 code units of the Java string. Unlike the modified UTF-8 representation,
+ * it can be passed to JS without transcoding and doesn't mangle supplementary characters.
+ */
+inline std::u16string readJString(JNIEnv *env, jstring string) {
+  jsize length = env->GetStringLength(string);
+  std::u16string result(length, u'\0');
+  env->GetStringRegion(string, 0, length, reinterpret_cast<jchar *>(result.data()));
+  return result;
+}
+
+} // namespace expo
@@ -10,12 +10,12 @@ namespace expo {
 
 JavaCallback::CallbackContext::CallbackContext(
   jsi::Runtime &rt,
-  std::weak_ptr<react::CallInvoker> jsCallInvokerHolder,
+  std::weak_ptr<PromiseSettlementQueue> settlementQueueHolder,
   std::optional<jsi::Function> resolveHolder,
   std::optional<jsi::Function> rejectHolder
 ) : react::LongLivedObject(rt),
     rt(rt),
-    jsCallInvokerHolder(std::move(jsCallInvokerHolder)),
+    settlementQueueHolder(std::move(settlementQueueHolder)),
     resolveHolder(std::move(resolveHolder)),
     rejectHolder(std::move(rejectHolder)) {}
 
@@ -61,26 +61,30 @@ jni::local_ref<JavaCallback::javaobject> JavaCallback::newInstance(
   return object;
 }
 
-void JavaCallback::invokeWithResolver(
-  std::function<void(jsi::Runtime &rt, jsi::Function &jsFunction)> resolver
-) {
+void JavaCallback::enqueueSettlement(PromiseSettlementQueue::Settlement settlement) {
   const auto strongCallbackContext = this->callbackContext.lock();
   // The context were deallocated before the callback was invoked.
   if (strongCallbackContext == nullptr) {
     return;
   }
 
-  const auto jsInvoker = strongCallbackContext->jsCallInvokerHolder.lock();
-  // Call invoker is already released, so we cannot invoke the callback.
-  if (jsInvoker == nullptr) {
+  const auto settlementQueue = strongCallbackContext->settlementQueueHolder.lock();
+  // The runtime is already released, so we cannot invoke the callback.
+  if (settlementQueue == nullptr) {
     return;
   }
 
-  jsInvoker->invokeAsync(
+  settlementQueue->enqueue(std::move(settlement));
+}
+
+void JavaCallback::invokeWithResolver(
+  std::function<void(jsi::Runtime &rt, jsi::Function &jsFunction)> resolver
+) {
+  enqueueSettlement(
     [
       context = callbackContext,
       resolver = std::move(resolver)
-    ]() -> void {
+    ](jsi::Runtime &) -> void {
       auto strongContext = context.lock();
       // The context were deallocated before the callback was invoked.
       if (strongContext == nullptr) {
@@ -158,9 +162,7 @@ void JavaCallback::invokeFloat(float result) {
 
 void JavaCallback::invokeString(jni::alias_ref<jstring> result) {
   JNIEnv *env = jni::Environment::current();
-  const char *rawValue = env->GetStringUTFChars(result.get(), nullptr);
-  std::string parsedResult = rawValue;
-  env->ReleaseStringUTFChars(result.get(), rawValue);
+  std::u16string parsedResult = readJString(env, result.get());
   invokeWithResolver(
     [parsedResult = std::move(parsedResult)](jsi::Runtime &rt, jsi::Function &jsFunction) {
       jsFunction.call(rt, convertToJS(jni::Environment::current(), rt, parsedResult));
@@ -259,24 +261,12 @@ void JavaCallback::invokeFloatArray(jni::alias_ref<jni::JArrayFloat> result) {
 }
 
 void JavaCallback::invokeError(jni::alias_ref<jstring> code, jni::alias_ref<jstring> errorMessage) {
-  const auto strongCallbackContext = this->callbackContext.lock();
-  // The context were deallocated before the callback was invoked.
-  if (strongCallbackContext == nullptr) {
-    return;
-  }
-
-  const auto jsInvoker = strongCallbackContext->jsCallInvokerHolder.lock();
-  // Call invoker is already released, so we cannot invoke the callback.
-  if (jsInvoker == nullptr) {
-    return;
-  }
-
-  jsInvoker->invokeAsync(
+  enqueueSettlement(
     [
       context = callbackContext,
       code = code->toStdString(),
       errorMessage = errorMessage->toStdString()
-    ]() -> void {
+    ](jsi::Runtime &) -> void {
       auto strongContext = context.lock();
       // The context were deallocated before the callback was invoked.
       if (strongContext == nullptr) {
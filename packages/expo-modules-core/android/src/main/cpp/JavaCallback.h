@@ -8,6 +8,7 @@
 #include "ArrayBuffer.h"
 #include "JavaScriptArrayBuffer.h"
 #include "NativeArrayBuffer.h"
+#include "PromiseSettlementQueue.h"
 
 #include <fbjni/detail/CoreClasses.h>
 #include <ReactCommon/CallInvoker.h>
@@ -31,13 +32,13 @@ public:
   public:
     CallbackContext(
       jsi::Runtime &rt,
-      std::weak_ptr<react::CallInvoker> jsCallInvokerHolder,
+      std::weak_ptr<PromiseSettlementQueue> settlementQueueHolder,
       std::optional<jsi::Function> resolveHolder,
       std::optional<jsi::Function> rejectHolder
     );
 
     jsi::Runtime &rt;
-    std::weak_ptr<react::CallInvoker> jsCallInvokerHolder;
+    std::weak_ptr<PromiseSettlementQueue> settlementQueueHolder;
     std::optional<jsi::Function> resolveHolder;
     std::optional<jsi::Function> rejectHolder;
 
@@ -95,6 +96,11 @@ private:
 
   void invokeWithResolver(std::function<void(jsi::Runtime &rt, jsi::Function &jsFunction)> resolver);
 
+  /**
+   * Adds the settlement to the queue of the runtime, so it's run together with other results on the JS thread.
+   */
+  void enqueueSettlement(PromiseSettlementQueue::Settlement settlement);
+
   template<class T>
   void invokeJSFunctionForArray(T &arg);
 };
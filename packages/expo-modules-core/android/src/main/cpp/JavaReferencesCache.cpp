@@ -5,7 +5,7 @@
 
 namespace expo {
 
-JCache::JCache(JNIEnv *env) {
+JCache::JCache(JNIEnv *env) : jClassReturnTypeCache(env) {
 #define REGISTER_CLASS_WITH_CONSTRUCTOR(variable, name, signature) \
     { \
       auto clazz = (jclass) env->NewGlobalRef(env->FindClass(name)); \
@@ -108,6 +108,8 @@ void JCache::unLoad(JNIEnv *env) {
   env->DeleteGlobalRef(jWritableNativeMap);
   env->DeleteGlobalRef(jSharedObject);
   env->DeleteGlobalRef(jJavaScriptModuleObject);
+  jStringInternCache.unLoad(env);
+  jClassReturnTypeCache.unLoad(env);
 }
 
 jobject JCache::getJUndefined(JNIEnv *env) {
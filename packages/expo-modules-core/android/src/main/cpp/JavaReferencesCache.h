@@ -3,6 +3,8 @@
 #pragma once
 
 #include "ExpoHeader.pch"
+#include "JStrings.h"
+#include "JClassReturnTypeCache.h"
 
 namespace jni = facebook::jni;
 
@@ -59,6 +61,10 @@ public:
 
   jobject jUndefined;
 
+  JStringInternCache jStringInternCache;
+
+  JClassReturnTypeCache jClassReturnTypeCache;
+
   void unLoad(JNIEnv *env);
 private:
   static jobject getJUndefined(JNIEnv *env);
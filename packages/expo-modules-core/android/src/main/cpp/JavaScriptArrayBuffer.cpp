@@ -20,8 +20,13 @@ void JavaScriptArrayBuffer::registerNatives() {
 
 JavaScriptArrayBuffer::JavaScriptArrayBuffer(
   std::weak_ptr<JavaScriptRuntime> runtime,
-  std::shared_ptr<jsi::ArrayBuffer> jsObject
-) : runtimeHolder(std::move(runtime)), arrayBuffer(std::move(jsObject)) {
+  std::shared_ptr<jsi::ArrayBuffer> jsObject,
+  size_t byteOffset,
+  std::optional<size_t> byteLength
+) : runtimeHolder(std::move(runtime)),
+    arrayBuffer(std::move(jsObject)),
+    byteOffset(byteOffset),
+    byteLength(byteLength) {
   assert((!runtimeHolder.expired()) && "JS Runtime was used after deallocation");
 }
 
@@ -38,11 +43,31 @@ jni::local_ref<JavaScriptArrayBuffer::javaobject> JavaScriptArrayBuffer::newInst
   return value;
 }
 
+jni::local_ref<JavaScriptArrayBuffer::javaobject> JavaScriptArrayBuffer::newInstance(
+  JSIContext *jsiContext,
+  std::weak_ptr<JavaScriptRuntime> runtime,
+  std::shared_ptr<jsi::ArrayBuffer> jsValue,
+  size_t byteOffset,
+  size_t byteLength
+) {
+  auto value = JavaScriptArrayBuffer::newObjectCxxArgs(
+    std::move(runtime),
+    std::move(jsValue),
+    byteOffset,
+    byteLength
+  );
+  jsiContext->jniDeallocator->addReference(value);
+  return value;
+}
+
 int JavaScriptArrayBuffer::size() {
   auto runtime = runtimeHolder.lock();
   assert((runtime != nullptr) && "JS Runtime was used after deallocation");
   auto &rawRuntime = runtime->get();
 
+  if (byteLength) {
+    return (int) *byteLength;
+  }
   return (int) arrayBuffer->size(rawRuntime);
 }
 
@@ -51,7 +76,7 @@ uint8_t *JavaScriptArrayBuffer::data() {
   assert((runtime != nullptr) && "JS Runtime was used after deallocation");
   auto &rawRuntime = runtime->get();
 
-  return arrayBuffer->data(rawRuntime);
+  return arrayBuffer->data(rawRuntime) + byteOffset;
 }
 
 jni::local_ref<jni::JByteBuffer> JavaScriptArrayBuffer::toDirectBuffer() {
@@ -61,7 +86,24 @@ jni::local_ref<jni::JByteBuffer> JavaScriptArrayBuffer::toDirectBuffer() {
 }
 
 std::shared_ptr<jsi::ArrayBuffer> JavaScriptArrayBuffer::jsiArrayBuffer() {
-  return this->arrayBuffer;
+  if (!byteLength) {
+    return this->arrayBuffer;
+  }
+  auto runtime = runtimeHolder.lock();
+  assert((runtime != nullptr) && "JS Runtime was used after deallocation");
+  auto &rawRuntime = runtime->get();
+
+  if (byteOffset == 0 && *byteLength == arrayBuffer->size(rawRuntime)) {
+    return this->arrayBuffer;
+  }
+  // JS expects a standalone buffer with just the exposed bytes, so this is the only place where they are copied.
+  auto slice = arrayBuffer
+    ->getPropertyAsFunction(rawRuntime, "slice")
+    .callWithThis(rawRuntime, *arrayBuffer, {
+      jsi::Value((double) byteOffset),
+      jsi::Value((double) (byteOffset + *byteLength))
+    });
+  return std::make_shared<jsi::ArrayBuffer>(slice.asObject(rawRuntime).getArrayBuffer(rawRuntime));
 }
 
 }
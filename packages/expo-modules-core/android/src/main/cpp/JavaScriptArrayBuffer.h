@@ -6,6 +6,8 @@
 
 #include <fbjni/ByteBuffer.h>
 
+#include <optional>
+
 namespace expo {
 
 class JavaScriptRuntime;
@@ -27,9 +29,23 @@ public:
     std::shared_ptr<jsi::ArrayBuffer> arrayBuffer
   );
 
+  /**
+   * Creates an instance exposing only the given range of the buffer, e.g. the bytes viewed by a typed array.
+   * The buffer is shared, not copied.
+   */
+  static jni::local_ref<JavaScriptArrayBuffer::javaobject> newInstance(
+    JSIContext *jSIContext,
+    std::weak_ptr<JavaScriptRuntime> runtime,
+    std::shared_ptr<jsi::ArrayBuffer> arrayBuffer,
+    size_t byteOffset,
+    size_t byteLength
+  );
+
   JavaScriptArrayBuffer(
     std::weak_ptr<JavaScriptRuntime> runtime,
-    std::shared_ptr<jsi::ArrayBuffer> arrayBuffer
+    std::shared_ptr<jsi::ArrayBuffer> arrayBuffer,
+    size_t byteOffset = 0,
+    std::optional<size_t> byteLength = std::nullopt
   );
 
   [[nodiscard]] int size();
@@ -38,6 +54,10 @@ public:
 
   [[nodiscard]] jni::local_ref<jni::JByteBuffer> toDirectBuffer();
 
+  /**
+   * Returns the buffer to pass back to JS. If only a part of the buffer is exposed,
+   * returns a new buffer with a copy of that part.
+   */
   [[nodiscard]] std::shared_ptr<jsi::ArrayBuffer> jsiArrayBuffer();
 
   template<class T>
@@ -48,5 +68,10 @@ public:
 private:
   std::weak_ptr<JavaScriptRuntime> runtimeHolder;
   std::shared_ptr<jsi::ArrayBuffer> arrayBuffer;
+  size_t byteOffset;
+  /**
+   * Length of the exposed range, or `std::nullopt` when the whole buffer is exposed.
+   */
+  std::optional<size_t> byteLength;
 };
 } // namespace expo
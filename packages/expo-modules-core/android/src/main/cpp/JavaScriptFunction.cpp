@@ -11,6 +11,7 @@ namespace expo {
 void JavaScriptFunction::registerNatives() {
   registerHybrid({
                    makeNativeMethod("invoke", JavaScriptFunction::invoke),
+                   makeNativeMethod("isAttached", JavaScriptFunction::jniIsAttached),
                  });
 }
 
@@ -21,17 +22,28 @@ JavaScriptFunction::JavaScriptFunction(
   assert((!runtimeHolder.expired()) && "JS Runtime was used after deallocation");
 }
 
+JavaScriptFunction::~JavaScriptFunction() {
+  removeFromTable();
+}
+
 std::shared_ptr<jsi::Function> JavaScriptFunction::get() {
   return jsFunction;
 }
 
+void JavaScriptFunction::detach() noexcept {
+  jsFunction.reset();
+}
+
+bool JavaScriptFunction::jniIsAttached() noexcept {
+  return isAttached();
+}
+
 jobject JavaScriptFunction::invoke(
   jni::alias_ref<JavaScriptObject::javaobject> jsThis,
   jni::alias_ref<jni::JArrayClass<jobject>> args,
   jni::alias_ref<ExpectedType::javaobject> expectedReturnType
 ) {
-  auto runtime = runtimeHolder.lock();
-  assert((runtime != nullptr) && "JS Runtime was used after deallocation");
+  auto runtime = lockRuntime(runtimeHolder);
   auto &rawRuntime = runtime->get();
 
   JNIEnv *env = jni::Environment::current();
@@ -65,7 +77,7 @@ jni::local_ref<JavaScriptFunction::javaobject> JavaScriptFunction::newInstance(
     std::move(runtime),
     std::move(jsFunction)
   );
-  jsiContext->jniDeallocator->addReference(function);
+  jsiContext->jsiHandles->add(function->cthis());
   return function;
 }
 } // namespace expo
@@ -5,6 +5,7 @@
 #include "ExpoHeader.pch"
 #include "JSIObjectWrapper.h"
 #include "JavaScriptRuntime.h"
+#include "JSIHandle.h"
 #include "types/ExpectedType.h"
 
 namespace jni = facebook::jni;
@@ -17,7 +18,7 @@ class JavaScriptObject;
 /**
  * Represents any JavaScript function. Its purpose is to expose the `jsi::Function` API back to Kotlin.
  */
-class JavaScriptFunction : public jni::HybridClass<JavaScriptFunction, Destructible>, JSIFunctionWrapper {
+class JavaScriptFunction : public jni::HybridClass<JavaScriptFunction, Destructible>, JSIFunctionWrapper, public JSIHandle {
 public:
   static auto constexpr
     kJavaDescriptor = "Lexpo/modules/kotlin/jni/JavaScriptFunction;";
@@ -36,8 +37,15 @@ public:
     std::shared_ptr<jsi::Function> jsFunction
   );
 
+  ~JavaScriptFunction() override;
+
   std::shared_ptr<jsi::Function> get() override;
 
+  /**
+   * Releases the underlying JS function.
+   */
+  void detach() noexcept override;
+
 private:
   friend HybridBase;
 
@@ -49,6 +57,8 @@ private:
     jni::alias_ref<jni::JArrayClass<jobject>> args,
     jni::alias_ref<ExpectedType::javaobject> expectedReturnType
   );
+
+  bool jniIsAttached() noexcept;
 };
 
 } // namespace expo
@@ -4,6 +4,10 @@
 #include "NativeModule.h"
 
 #include "decorators/JSDecoratorsBridgingObject.h"
+#include "decorators/JSFunctionsDecorator.h"
+
+#include <algorithm>
+#include <iterator>
 
 namespace expo {
 
@@ -15,25 +19,103 @@ JavaScriptModuleObject::initHybrid(jni::alias_ref<jhybridobject> jThis) {
 void JavaScriptModuleObject::registerNatives() {
   registerHybrid({
                    makeNativeMethod("initHybrid", JavaScriptModuleObject::initHybrid),
-                   makeNativeMethod("decorate", JavaScriptModuleObject::decorate)
+                   makeNativeMethod("decorate", JavaScriptModuleObject::decorate),
+                   makeNativeMethod("getFunctionCallStatsNative", JavaScriptModuleObject::getFunctionCallStats)
                  });
 }
 
 std::shared_ptr<jsi::Object> JavaScriptModuleObject::getJSIObject(jsi::Runtime &runtime) {
+  auto moduleObject = getLazyJSIObject(runtime);
+  decorateMember(runtime, *moduleObject, std::nullopt);
+  return moduleObject;
+}
+
+std::shared_ptr<jsi::Object> JavaScriptModuleObject::getLazyJSIObject(jsi::Runtime &runtime) {
   if (auto object = jsiObject.lock()) {
     return object;
   }
 
   auto moduleObject = std::make_shared<jsi::Object>(NativeModule::createInstance(runtime));
 
+  // Members of the previous object (if any) need to be defined again on the new one.
+  decoratedMembers.clear();
+  eagerMembers.clear();
+  isFullyDecorated = false;
+
   for (const auto& decorator : this->decorators) {
-    decorator->decorate(runtime, *moduleObject);
+    if (!decorator->supportsMemberDecoration()) {
+      for (auto &memberName : decorator->getMemberNames()) {
+        eagerMembers.insert(std::move(memberName));
+      }
+      decorator->decorate(runtime, *moduleObject);
+    }
   }
 
   jsiObject = moduleObject;
   return moduleObject;
 }
 
+void JavaScriptModuleObject::decorateMember(
+  jsi::Runtime &runtime,
+  jsi::Object &moduleObject,
+  const std::optional<std::string> &name
+) {
+  if (isFullyDecorated) {
+    return;
+  }
+
+  if (name) {
+    if (eagerMembers.contains(*name) || !decoratedMembers.insert(*name).second) {
+      return;
+    }
+    // When multiple decorators provide the same member, the last one would win when applied eagerly.
+    // Decorators are probed in reverse order, so the probing can stop once the member is defined.
+    for (auto it = this->decorators.rbegin(); it != this->decorators.rend(); ++it) {
+      const auto &decorator = *it;
+      if (decorator->supportsMemberDecoration() && decorator->decorateMember(runtime, moduleObject, *name)) {
+        break;
+      }
+    }
+    return;
+  }
+
+  for (const auto& decorator : this->decorators) {
+    if (!decorator->supportsMemberDecoration()) {
+      continue;
+    }
+    if (decoratedMembers.empty() && eagerMembers.empty()) {
+      // Nothing was accessed yet and nothing can be overridden, so the whole decorator can be applied at once.
+      decorator->decorate(runtime, moduleObject);
+      continue;
+    }
+    for (const auto &memberName : decorator->getMemberNames()) {
+      if (!decoratedMembers.contains(memberName) && !eagerMembers.contains(memberName)) {
+        decorator->decorateMember(runtime, moduleObject, memberName);
+      }
+    }
+  }
+  decoratedMembers.clear();
+  isFullyDecorated = true;
+}
+
+std::vector<std::string> JavaScriptModuleObject::getLazyMemberNames() const {
+  std::vector<std::string> names;
+  for (const auto& decorator : this->decorators) {
+    if (decorator->supportsMemberDecoration()) {
+      auto memberNames = decorator->getMemberNames();
+      names.insert(names.end(), std::make_move_iterator(memberNames.begin()), std::make_move_iterator(memberNames.end()));
+    }
+  }
+  // A member can be provided by multiple decorators, but it's defined only once.
+  std::sort(names.begin(), names.end());
+  names.erase(std::unique(names.begin(), names.end()), names.end());
+  // Members defined eagerly win, so they never need to be defined lazily.
+  std::erase_if(names, [this](const std::string &name) {
+    return eagerMembers.contains(name);
+  });
+  return names;
+}
+
 void JavaScriptModuleObject::decorate(jni::alias_ref<JSDecoratorsBridgingObject::javaobject> jsDecoratorsBridgingObject) noexcept {
   this->decorators = jsDecoratorsBridgingObject->cthis()->bridge();
 }
@@ -42,4 +124,31 @@ std::weak_ptr<jsi::Object> JavaScriptModuleObject::getCachedJSIObject() {
   return jsiObject;
 }
 
+jni::local_ref<jni::JArrayLong> JavaScriptModuleObject::getFunctionCallStats(jni::alias_ref<jstring> name) {
+  std::string functionName = name->toStdString();
+
+  for (const auto &decorator : this->decorators) {
+    auto functionsDecorator = dynamic_cast<JSFunctionsDecorator *>(decorator.get());
+    if (functionsDecorator == nullptr) {
+      continue;
+    }
+    auto metadata = functionsDecorator->getMethodMetadata(functionName);
+    if (metadata == nullptr) {
+      continue;
+    }
+
+    MethodMetadata::CallStats stats = metadata->getCallStats();
+    jlong values[] = {
+      static_cast<jlong>(stats.calls),
+      static_cast<jlong>(stats.primitiveCalls),
+      static_cast<jlong>(stats.reusedArgsArrays),
+      static_cast<jlong>(stats.allocatedArgsArrays)
+    };
+    auto result = jni::JArrayLong::newArray(4);
+    result->setRegion(0, 4, values);
+    return result;
+  }
+  return nullptr;
+}
+
 } // namespace expo
@@ -6,6 +6,9 @@
 
 #include "decorators/JSDecorator.h"
 
+#include <optional>
+#include <unordered_set>
+
 namespace jni = facebook::jni;
 namespace jsi = facebook::jsi;
 
@@ -41,6 +44,24 @@ public:
    */
   std::shared_ptr<jsi::Object> getJSIObject(jsi::Runtime &runtime);
 
+  /**
+   * Returns a cached instance of jsi::Object representing this module, without the members
+   * that can be defined lazily (functions, constants and properties).
+   * These members need to be defined on access with `decorateMember`.
+   */
+  std::shared_ptr<jsi::Object> getLazyJSIObject(jsi::Runtime &runtime);
+
+  /**
+   * Defines the member with the given name on the module object, if it wasn't defined yet.
+   * When `name` is `std::nullopt`, all of the remaining members are defined.
+   */
+  void decorateMember(jsi::Runtime &runtime, jsi::Object &moduleObject, const std::optional<std::string> &name);
+
+  /**
+   * Returns names of all members that can be defined with `decorateMember`.
+   */
+  std::vector<std::string> getLazyMemberNames() const;
+
   std::weak_ptr<jsi::Object> getCachedJSIObject();
 
   /**
@@ -48,6 +69,12 @@ public:
    */
   void decorate(jni::alias_ref<jni::HybridClass<JSDecoratorsBridgingObject>::javaobject> jsDecoratorsBridgingObject) noexcept;
 
+  /**
+   * Returns the call counters of the function with the given name as `[calls, primitiveCalls, reusedArgsArrays, allocatedArgsArrays]`,
+   * or `null` if the module doesn't have such function. See `MethodMetadata::CallStats`.
+   */
+  jni::local_ref<jni::JArrayLong> getFunctionCallStats(jni::alias_ref<jstring> name);
+
 private:
   friend HybridBase;
   friend MainRuntimeInstaller;
@@ -61,5 +88,21 @@ private:
   std::weak_ptr<jsi::Object> jsiObject;
 
   std::vector<std::unique_ptr<JSDecorator>> decorators;
+
+  /**
+   * Names of the members defined eagerly, e.g. classes and objects. They take precedence over the lazily defined
+   * members with the same names, as the eager decorators used to be applied after the lazy ones.
+   */
+  std::unordered_set<std::string> eagerMembers;
+
+  /**
+   * Names of the lazily defined members that have already been defined on the current `jsiObject`.
+   */
+  std::unordered_set<std::string> decoratedMembers;
+
+  /**
+   * Whether all of the lazily defined members have been defined on the current `jsiObject`.
+   */
+  bool isFullyDecorated = false;
 };
 } // namespace expo
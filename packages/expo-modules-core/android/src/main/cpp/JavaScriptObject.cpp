@@ -44,6 +44,7 @@ void JavaScriptObject::registerNatives() {
                    makeNativeMethod("getArray", JavaScriptObject::getArray),
                    makeNativeMethod("isArrayBuffer", JavaScriptObject::isArrayBuffer),
                    makeNativeMethod("getArrayBuffer", JavaScriptObject::getArrayBuffer),
+                   makeNativeMethod("isAttached", JavaScriptObject::jniIsAttached),
                  });
 }
 
@@ -54,27 +55,36 @@ JavaScriptObject::JavaScriptObject(
   assert((!runtimeHolder.expired()) && "JS Runtime was used after deallocation");
 }
 
+JavaScriptObject::~JavaScriptObject() {
+  removeFromTable();
+}
+
 std::shared_ptr<jsi::Object> JavaScriptObject::get() {
   return jsObject;
 }
 
+void JavaScriptObject::detach() noexcept {
+  jsObject.reset();
+}
+
+bool JavaScriptObject::jniIsAttached() noexcept {
+  return isAttached();
+}
+
 jsi::Runtime &JavaScriptObject::getRuntime() {
-  auto runtime = runtimeHolder.lock();
-  assert((runtime != nullptr) && "JS Runtime was used after deallocation");
+  auto runtime = lockRuntime(runtimeHolder);
   return runtime->get();
 }
 
 bool JavaScriptObject::hasProperty(const std::string &name) {
-  auto runtime = runtimeHolder.lock();
-  assert((runtime != nullptr) && "JS Runtime was used after deallocation");
+  auto runtime = lockRuntime(runtimeHolder);
   auto &rawRuntime = runtime->get();
 
   return jsObject->hasProperty(rawRuntime, name.c_str());
 }
 
 jsi::Value JavaScriptObject::getProperty(const std::string &name) {
-  auto runtime = runtimeHolder.lock();
-  assert((runtime != nullptr) && "JS Runtime was used after deallocation");
+  auto runtime = lockRuntime(runtimeHolder);
   auto &rawRuntime = runtime->get();
 
   return jsObject->getProperty(rawRuntime, name.c_str());
@@ -87,8 +97,7 @@ bool JavaScriptObject::jniHasProperty(jni::alias_ref<jstring> name) {
 jni::local_ref<JavaScriptValue::javaobject> JavaScriptObject::jniGetProperty(
   jni::alias_ref<jstring> name
 ) {
-  auto runtime = runtimeHolder.lock();
-  assert((runtime != nullptr) && "JS Runtime was used after deallocation");
+  auto runtime = lockRuntime(runtimeHolder);
   auto &rawRuntime = runtime->get();
 
   auto result = std::make_shared<jsi::Value>(getProperty(name->toStdString()));
@@ -100,8 +109,7 @@ jni::local_ref<JavaScriptValue::javaobject> JavaScriptObject::jniGetProperty(
 }
 
 std::vector<std::string> JavaScriptObject::getPropertyNames() {
-  auto runtime = runtimeHolder.lock();
-  assert((runtime != nullptr) && "JS Runtime was used after deallocation");
+  auto runtime = lockRuntime(runtimeHolder);
   auto &rawRuntime = runtime->get();
 
   jsi::Array properties = jsObject->getPropertyNames(rawRuntime);
@@ -131,8 +139,7 @@ jni::local_ref<jni::JArrayClass<jstring>> JavaScriptObject::jniGetPropertyNames(
 
 jni::local_ref<jni::HybridClass<JavaScriptWeakObject, Destructible>::javaobject>
 JavaScriptObject::createWeak() {
-  auto runtime = runtimeHolder.lock();
-  assert((runtime != nullptr) && "JS Runtime was used after deallocation");
+  auto runtime = lockRuntime(runtimeHolder);
   auto &rawRuntime = runtime->get();
 
   return JavaScriptWeakObject::newInstance(
@@ -143,8 +150,7 @@ JavaScriptObject::createWeak() {
 }
 
 jni::local_ref<JavaScriptFunction::javaobject> JavaScriptObject::jniAsFunction() {
-  auto runtime = runtimeHolder.lock();
-  assert((runtime != nullptr) && "JS Runtime was used after deallocation");
+  auto runtime = lockRuntime(runtimeHolder);
   auto &rawRuntime = runtime->get();
 
   auto jsFuncion = std::make_shared<jsi::Function>(jsObject->asFunction(rawRuntime));
@@ -156,16 +162,14 @@ jni::local_ref<JavaScriptFunction::javaobject> JavaScriptObject::jniAsFunction()
 }
 
 void JavaScriptObject::setProperty(const std::string &name, jsi::Value value) {
-  auto runtime = runtimeHolder.lock();
-  assert((runtime != nullptr) && "JS Runtime was used after deallocation");
+  auto runtime = lockRuntime(runtimeHolder);
   auto &rawRuntime = runtime->get();
 
   jsObject->setProperty(rawRuntime, name.c_str(), value);
 }
 
 void JavaScriptObject::unsetProperty(jni::alias_ref<jstring> name) {
-  auto runtime = runtimeHolder.lock();
-  assert((runtime != nullptr) && "JS Runtime was used after deallocation");
+  auto runtime = lockRuntime(runtimeHolder);
   auto &rawRuntime = runtime->get();
 
   auto cName = name->toStdString();
@@ -195,15 +199,14 @@ jni::local_ref<JavaScriptObject::javaobject> JavaScriptObject::newInstance(
   std::shared_ptr<jsi::Object> jsObject
 ) {
   auto object = JavaScriptObject::newObjectCxxArgs(std::move(runtime), std::move(jsObject));
-  jsiContext->jniDeallocator->addReference(object);
+  jsiContext->jsiHandles->add(object->cthis());
   return object;
 }
 
 void JavaScriptObject::defineNativeDeallocator(
   jni::alias_ref<JNIFunctionBody::javaobject> deallocator
 ) {
-  auto runtime = runtimeHolder.lock();
-  assert((runtime != nullptr) && "JS Runtime was used after deallocation");
+  auto runtime = lockRuntime(runtimeHolder);
   auto &rawRuntime = runtime->get();
 
   jni::global_ref<JNIFunctionBody::javaobject> globalRef = jni::make_global(deallocator);
@@ -224,24 +227,21 @@ void JavaScriptObject::defineNativeDeallocator(
 }
 
 void JavaScriptObject::setExternalMemoryPressure(int size) {
-  auto runtime = runtimeHolder.lock();
-  assert((runtime != nullptr) && "JS Runtime was used after deallocation");
+  auto runtime = lockRuntime(runtimeHolder);
   auto &rawRuntime = runtime->get();
 
   jsObject->setExternalMemoryPressure(rawRuntime, size);
 }
 
 bool JavaScriptObject::isArray() {
-  auto runtime = runtimeHolder.lock();
-  assert((runtime != nullptr) && "JS Runtime was used after deallocation");
+  auto runtime = lockRuntime(runtimeHolder);
   auto &rawRuntime = runtime->get();
 
   return jsObject->isArray(rawRuntime);
 }
 
 jni::local_ref<jni::JArrayClass<JavaScriptValue::javaobject>> JavaScriptObject::getArray() {
-  auto runtime = runtimeHolder.lock();
-  assert((runtime != nullptr) && "JS Runtime was used after deallocation");
+  auto runtime = lockRuntime(runtimeHolder);
   auto &rawRuntime = runtime->get();
   auto jsiContext = expo::getJSIContext(rawRuntime);
 
@@ -262,16 +262,14 @@ jni::local_ref<jni::JArrayClass<JavaScriptValue::javaobject>> JavaScriptObject::
 }
 
 bool JavaScriptObject::isArrayBuffer() {
-  auto runtime = runtimeHolder.lock();
-  assert((runtime != nullptr) && "JS Runtime was used after deallocation");
+  auto runtime = lockRuntime(runtimeHolder);
   auto &rawRuntime = runtime->get();
 
   return jsObject->isArrayBuffer(rawRuntime);
 }
 
 jni::local_ref<JavaScriptArrayBuffer::javaobject> JavaScriptObject::getArrayBuffer() {
-  auto runtime = runtimeHolder.lock();
-  assert((runtime != nullptr) && "JS Runtime was used after deallocation");
+  auto runtime = lockRuntime(runtimeHolder);
   auto &rawRuntime = runtime->get();
   auto jsiContext = expo::getJSIContext(rawRuntime);
 
@@ -8,6 +8,7 @@
 #include "JavaScriptRuntime.h"
 #include "JNIFunctionBody.h"
 #include "JNIDeallocator.h"
+#include "JSIHandle.h"
 #include "JSIUtils.h"
 
 namespace jni = facebook::jni;
@@ -23,7 +24,7 @@ class JavaScriptArrayBuffer;
 /**
  * Represents any JavaScript object. Its purpose is to exposes `jsi::Object` API back to Kotlin.
  */
-class JavaScriptObject : public jni::HybridClass<JavaScriptObject, Destructible>, JSIObjectWrapper {
+class JavaScriptObject : public jni::HybridClass<JavaScriptObject, Destructible>, JSIObjectWrapper, public JSIHandle {
 public:
   static auto constexpr
     kJavaDescriptor = "Lexpo/modules/kotlin/jni/JavaScriptObject;";
@@ -42,8 +43,15 @@ public:
     std::shared_ptr<jsi::Object> jsObject
   );
 
+  ~JavaScriptObject() override;
+
   std::shared_ptr<jsi::Object> get() override;
 
+  /**
+   * Releases the underlying JS object.
+   */
+  void detach() noexcept override;
+
   /**
    * @return the `jsi::Runtime` this object is bound to.
    */
@@ -102,6 +110,8 @@ private:
 
   jni::local_ref<jni::HybridClass<JavaScriptFunction, Destructible>::javaobject> jniAsFunction();
 
+  bool jniIsAttached() noexcept;
+
   /**
    * Unsets property with the given name.
    */
@@ -122,8 +132,7 @@ private:
     typename = std::enable_if_t<is_jsi_type_converter_defined<T>>
   >
   void setProperty(jni::alias_ref<jstring> name, T value) {
-    auto runtime = runtimeHolder.lock();
-    assert((runtime != nullptr) && "JS Runtime was used after deallocation");
+    auto runtime = lockRuntime(runtimeHolder);
     auto &rawRuntime = runtime->get();
 
     auto cName = name->toStdString();
@@ -139,8 +148,7 @@ private:
     typename = std::enable_if_t<is_jsi_type_converter_defined<T>>
   >
   void defineProperty(jni::alias_ref<jstring> name, T value, int options) {
-    auto runtime = runtimeHolder.lock();
-    assert((runtime != nullptr) && "JS Runtime was used after deallocation");
+    auto runtime = lockRuntime(runtimeHolder);
     auto &rawRuntime = runtime->get();
 
     auto cName = name->toStdString();
@@ -18,6 +18,16 @@ JavaScriptTypedArray::JavaScriptTypedArray(
   rawPointer = static_cast<char *>(typedArrayWrapper->getRawPointer(rawRuntime));
 }
 
+JavaScriptTypedArray::~JavaScriptTypedArray() {
+  removeFromTable();
+}
+
+void JavaScriptTypedArray::detach() noexcept {
+  typedArrayWrapper.reset();
+  rawPointer = nullptr;
+  JavaScriptObject::detach();
+}
+
 void JavaScriptTypedArray::registerNatives() {
   registerHybrid({
                    makeNativeMethod("getRawKind", JavaScriptTypedArray::getRawKind),
@@ -42,16 +52,14 @@ void JavaScriptTypedArray::registerNatives() {
 }
 
 int JavaScriptTypedArray::getRawKind() {
-  auto runtime = runtimeHolder.lock();
-  assert((runtime != nullptr) && "JS Runtime was used after deallocation");
+  auto runtime = lockRuntime(runtimeHolder);
   auto &rawRuntime = runtime->get();
 
   return (int) typedArrayWrapper->getKind(rawRuntime);
 }
 
 jni::local_ref<jni::JByteBuffer> JavaScriptTypedArray::toDirectBuffer() {
-  auto runtime = runtimeHolder.lock();
-  assert((runtime != nullptr) && "JS Runtime was used after deallocation");
+  auto runtime = lockRuntime(runtimeHolder);
   auto &rawRuntime = runtime->get();
 
   auto byteLength = typedArrayWrapper->byteLength(rawRuntime);
@@ -71,6 +79,7 @@ void JavaScriptTypedArray::readBuffer(
   int position,
   int size
 ) {
+  ensureAttached();
   buffer->setRegion(
     0,
     size,
@@ -83,6 +92,7 @@ void JavaScriptTypedArray::writeBuffer(
   int position,
   int size
 ) {
+  ensureAttached();
   auto region = buffer->getRegion(0, size);
   memcpy(rawPointer + position, region.get(), size);
 }
@@ -96,7 +106,7 @@ jni::local_ref<JavaScriptTypedArray::javaobject> JavaScriptTypedArray::newInstan
     std::move(runtime),
     std::move(jsObject)
   );
-  jSIContext->jniDeallocator->addReference(object);
+  jSIContext->jsiHandles->add(object->cthis());
   return object;
 }
 }
@@ -32,6 +32,13 @@ public:
     std::shared_ptr<jsi::Object> jsObject
   );
 
+  ~JavaScriptTypedArray() override;
+
+  /**
+   * Releases the underlying typed array and forgets the pointer to its buffer.
+   */
+  void detach() noexcept override;
+
   /**
    * Gets a raw kind of the underlying typed array.
    */
@@ -56,11 +63,13 @@ private:
 
   template<class T>
   T read(int position) {
+    ensureAttached();
     return *reinterpret_cast<T *>(rawPointer + position);
   }
 
   template<class T>
   void write(int position, T value) {
+    ensureAttached();
     *reinterpret_cast<T *>(rawPointer + position) = value;
   }
 };
@@ -32,6 +32,7 @@ void JavaScriptValue::registerNatives() {
                    makeNativeMethod("getArray", JavaScriptValue::getArray),
                    makeNativeMethod("getTypedArray", JavaScriptValue::getTypedArray),
                    makeNativeMethod("jniGetFunction", JavaScriptValue::jniGetFunction),
+                   makeNativeMethod("isAttached", JavaScriptValue::jniIsAttached),
                  });
 }
 
@@ -42,10 +43,24 @@ JavaScriptValue::JavaScriptValue(
   assert((!runtimeHolder.expired()) && "JS Runtime was used after deallocation");
 }
 
+JavaScriptValue::~JavaScriptValue() {
+  removeFromTable();
+}
+
 std::shared_ptr<jsi::Value> JavaScriptValue::get() {
   return jsValue;
 }
 
+void JavaScriptValue::detach() noexcept {
+  // `undefined` doesn't point to the runtime's memory, so it can be shared and outlive the runtime.
+  static const auto undefinedValue = std::make_shared<jsi::Value>();
+  jsValue = undefinedValue;
+}
+
+bool JavaScriptValue::jniIsAttached() noexcept {
+  return isAttached();
+}
+
 std::string JavaScriptValue::kind() {
   if (isNull()) {
     return "null";
@@ -106,8 +121,7 @@ bool JavaScriptValue::isSymbol() {
 
 bool JavaScriptValue::isFunction() {
   if (jsValue->isObject()) {
-    auto runtime = runtimeHolder.lock();
-    assert((runtime != nullptr) && "JS Runtime was used after deallocation");
+    auto runtime = lockRuntime(runtimeHolder);
     auto &rawRuntime = runtime->get();
 
     return jsValue->asObject(rawRuntime).isFunction(rawRuntime);
@@ -118,8 +132,7 @@ bool JavaScriptValue::isFunction() {
 
 bool JavaScriptValue::isArray() {
   if (jsValue->isObject()) {
-    auto runtime = runtimeHolder.lock();
-    assert((runtime != nullptr) && "JS Runtime was used after deallocation");
+    auto runtime = lockRuntime(runtimeHolder);
     auto &rawRuntime = runtime->get();
 
     return jsValue->asObject(rawRuntime).isArray(rawRuntime);
@@ -134,8 +147,7 @@ bool JavaScriptValue::isObject() {
 
 bool JavaScriptValue::isTypedArray() {
   if (jsValue->isObject()) {
-    auto runtime = runtimeHolder.lock();
-    assert((runtime != nullptr) && "JS Runtime was used after deallocation");
+    auto runtime = lockRuntime(runtimeHolder);
     auto &rawRuntime = runtime->get();
 
     return expo::isTypedArray(rawRuntime, jsValue->getObject(rawRuntime));
@@ -144,24 +156,24 @@ bool JavaScriptValue::isTypedArray() {
 }
 
 bool JavaScriptValue::getBool() {
+  ensureAttached();
   return jsValue->getBool();
 }
 
 double JavaScriptValue::getDouble() {
+  ensureAttached();
   return jsValue->getNumber();
 }
 
 std::string JavaScriptValue::getString() {
-  auto runtime = runtimeHolder.lock();
-  assert((runtime != nullptr) && "JS Runtime was used after deallocation");
+  auto runtime = lockRuntime(runtimeHolder);
   auto &rawRuntime = runtime->get();
 
   return jsValue->getString(rawRuntime).utf8(rawRuntime);
 }
 
 jni::local_ref<JavaScriptObject::javaobject> JavaScriptValue::getObject() {
-  auto runtime = runtimeHolder.lock();
-  assert((runtime != nullptr) && "JS Runtime was used after deallocation");
+  auto runtime = lockRuntime(runtimeHolder);
   auto &rawRuntime = runtime->get();
 
   auto jsObject = std::make_shared<jsi::Object>(jsValue->getObject(rawRuntime));
@@ -173,8 +185,7 @@ jni::local_ref<JavaScriptObject::javaobject> JavaScriptValue::getObject() {
 }
 
 jni::local_ref<JavaScriptFunction::javaobject> JavaScriptValue::jniGetFunction() {
-  auto runtime = runtimeHolder.lock();
-  assert((runtime != nullptr) && "JS Runtime was used after deallocation");
+  auto runtime = lockRuntime(runtimeHolder);
   auto &rawRuntime = runtime->get();
 
   auto jsFunction = std::make_shared<jsi::Function>(
@@ -187,8 +198,7 @@ jni::local_ref<JavaScriptFunction::javaobject> JavaScriptValue::jniGetFunction()
 }
 
 jni::local_ref<jni::JArrayClass<JavaScriptValue::javaobject>> JavaScriptValue::getArray() {
-  auto runtime = runtimeHolder.lock();
-  assert((runtime != nullptr) && "JS Runtime was used after deallocation");
+  auto runtime = lockRuntime(runtimeHolder);
   auto &rawRuntime = runtime->get();
   auto jsiContext = expo::getJSIContext(rawRuntime);
 
@@ -221,8 +231,7 @@ jni::local_ref<jstring> JavaScriptValue::jniGetString() {
 }
 
 jni::local_ref<JavaScriptTypedArray::javaobject> JavaScriptValue::getTypedArray() {
-  auto runtime = runtimeHolder.lock();
-  assert((runtime != nullptr) && "JS Runtime was used after deallocation");
+  auto runtime = lockRuntime(runtimeHolder);
   auto &rawRuntime = runtime->get();
 
   auto jsObject = std::make_shared<jsi::Object>(jsValue->getObject(rawRuntime));
@@ -242,7 +251,7 @@ jni::local_ref<JavaScriptValue::javaobject> JavaScriptValue::newInstance(
     std::move(runtime),
     std::move(jsValue)
   );
-  jsiContext->jniDeallocator->addReference(value);
+  jsiContext->jsiHandles->add(value->cthis());
   return value;
 }
 } // namespace expo
@@ -6,6 +6,7 @@
 #include "JSIObjectWrapper.h"
 #include "JavaScriptTypedArray.h"
 #include "JNIDeallocator.h"
+#include "JSIHandle.h"
 
 namespace jni = facebook::jni;
 namespace jsi = facebook::jsi;
@@ -24,7 +25,7 @@ class JavaScriptFunction;
 /**
  * Represents any JavaScript value. Its purpose is to expose the `jsi::Value` API back to Kotlin.
  */
-class JavaScriptValue : public jni::HybridClass<JavaScriptValue, Destructible>, JSIValueWrapper {
+class JavaScriptValue : public jni::HybridClass<JavaScriptValue, Destructible>, JSIValueWrapper, public JSIHandle {
 public:
   static auto constexpr
     kJavaDescriptor = "Lexpo/modules/kotlin/jni/JavaScriptValue;";
@@ -43,8 +44,15 @@ public:
     std::shared_ptr<jsi::Value> jsValue
   );
 
+  ~JavaScriptValue() override;
+
   std::shared_ptr<jsi::Value> get() override;
 
+  /**
+   * Replaces the value with `undefined`.
+   */
+  void detach() noexcept override;
+
   std::string kind();
 
   bool isNull();
@@ -90,5 +98,7 @@ private:
   jni::local_ref<jstring> jniKind();
 
   jni::local_ref<jstring> jniGetString();
+
+  bool jniIsAttached() noexcept;
 };
 } // namespace expo
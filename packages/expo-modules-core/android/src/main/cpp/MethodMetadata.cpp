@@ -6,7 +6,10 @@
 #include "JavaCallback.h"
 #include "types/JNIToJSIConverter.h"
 #include "JSReferencesCache.h"
+#include "JSIUtils.h"
 
+#include <atomic>
+#include <optional>
 #include <utility>
 
 #include <react/bridging/LongLivedObject.h>
@@ -17,24 +20,120 @@ namespace react = facebook::react;
 
 namespace expo {
 
-jni::local_ref<JavaCallback::JavaPart> createJavaCallback(
+namespace {
+
+/**
+ * Creates promises with a single native executor shared by all asynchronous functions in the runtime.
+ * The Promise constructor calls the executor synchronously, so it only stashes the resolving functions
+ * to be picked up right after, instead of a new host function being created for every call.
+ */
+class PromiseFactory {
+public:
+  static constexpr jsi::UUID uuid{0x1a84c8b1, 0x6004, 0x46b2, 0x8ca6, 0xbc5897b854e2};
+
+  struct Deferred {
+    jsi::Value promise;
+    jsi::Function resolve;
+    jsi::Function reject;
+  };
+
+  PromiseFactory(jsi::Runtime &runtime) : executor(
+    jsi::Function::createFromHostFunction(
+      runtime,
+      jsi::PropNameID::forAscii(runtime, "promiseFn"),
+      2,
+      [this](
+        jsi::Runtime &rt,
+        const jsi::Value &thisVal,
+        const jsi::Value *promiseConstructorArgs,
+        size_t promiseConstructorArgCount
+      ) {
+        if (promiseConstructorArgCount != 2) {
+          throw std::invalid_argument("Promise fn arg count must be 2");
+        }
+
+        pendingResolve = promiseConstructorArgs[0].getObject(rt).getFunction(rt);
+        pendingReject = promiseConstructorArgs[1].getObject(rt).getFunction(rt);
+        return jsi::Value::undefined();
+      }
+    )
+  ) {}
+
+  Deferred create(jsi::Runtime &rt, jsi::Function &promiseConstructor) {
+    jsi::Value promise = promiseConstructor.callAsConstructor(rt, executor);
+    Deferred deferred{
+      .promise = std::move(promise),
+      .resolve = std::move(*pendingResolve),
+      .reject = std::move(*pendingReject)
+    };
+    pendingResolve.reset();
+    pendingReject.reset();
+    return deferred;
+  }
+
+private:
+  jsi::Function executor;
+  std::optional<jsi::Function> pendingResolve;
+  std::optional<jsi::Function> pendingReject;
+};
+
+} // namespace
+
+std::shared_ptr<JavaCallback::CallbackContext> createCallbackContext(
   jsi::Function &&resolveFunction,
   jsi::Function &&rejectFunction,
   jsi::Runtime &rt
 ) {
-  JSIContext *jsiContext = getJSIContext(rt);
-  std::shared_ptr<react::CallInvoker> jsInvoker = jsiContext->runtimeHolder->jsInvoker;
-
   std::shared_ptr<JavaCallback::CallbackContext> callbackContext = std::make_shared<JavaCallback::CallbackContext>(
     rt,
-    std::move(jsInvoker),
+    getJSIContext(rt)->promiseSettlementQueue,
     std::move(resolveFunction),
     std::move(rejectFunction)
   );
 
   facebook::react::LongLivedObjectCollection::get(rt).add(callbackContext);
 
-  return JavaCallback::newInstance(jsiContext, std::move(callbackContext));
+  return callbackContext;
+}
+
+/**
+ * Code and message of a `CodedException` thrown by the Kotlin part.
+ */
+struct CodedErrorInfo {
+  std::string code;
+  std::string message;
+};
+
+/**
+ * Unboxes the code and message of the given JNI exception.
+ * Exceptions that aren't `CodedException`s are reported as `UnexpectedException`s.
+ */
+CodedErrorInfo getCodedErrorInfo(jni::JniException &jniException) {
+  jni::local_ref<jni::JThrowable> unboxedThrowable = jniException.getThrowable();
+  if (!unboxedThrowable->isInstanceOf(CodedException::javaClassLocal())) {
+    unboxedThrowable = UnexpectedException::create(jniException.what());
+  }
+
+  auto codedException = jni::static_ref_cast<CodedException>(unboxedThrowable);
+  return {
+    .code = codedException->getCode(),
+    .message = codedException->getLocalizedMessage().value_or("")
+  };
+}
+
+void rejectWithCodedError(
+  jsi::Runtime &rt,
+  jsi::Function &reject,
+  const CodedErrorInfo &error
+) {
+  reject.call(
+    rt,
+    makeCodedError(
+      rt,
+      jsi::String::createFromUtf8(rt, error.code),
+      jsi::String::createFromUtf8(rt, error.message)
+    )
+  );
 }
 
 jobjectArray MethodMetadata::convertJSIArgsToJNI(
@@ -44,6 +143,18 @@ jobjectArray MethodMetadata::convertJSIArgsToJNI(
   const jsi::Value *args,
   size_t count
 ) {
+  auto argumentArray = env->NewObjectArray(
+    getJNIArgsCount(count),
+    JCacheHolder::get().jObject,
+    nullptr
+  );
+  callStats.allocatedArgsArrays.fetch_add(1, std::memory_order_relaxed);
+
+  writeJSIArgsToJNI(env, rt, thisValue, args, count, argumentArray);
+  return argumentArray;
+}
+
+size_t MethodMetadata::getJNIArgsCount(size_t count) const {
   // This function takes the owner, so the args number is higher because we have access to the thisValue.
   if (info.takesOwner) {
     count++;
@@ -59,15 +170,33 @@ jobjectArray MethodMetadata::convertJSIArgsToJNI(
     );
   }
 
-  auto argumentArray = env->NewObjectArray(
-    count,
-    JCacheHolder::get().jObject,
-    nullptr
-  );
+  return count;
+}
+
+void MethodMetadata::writeJSIArgsToJNI(
+  JNIEnv *env,
+  jsi::Runtime &rt,
+  const jsi::Value &thisValue,
+  const jsi::Value *args,
+  size_t count,
+  jobjectArray argumentArray
+) {
+  if (info.takesOwner) {
+    count++;
+  }
+
+  // Wrappers created by the converters that are tracked by the deallocator, like array buffers, are registered all at once.
+  JNIDeallocatorBatch deallocatorBatch(getJSIContext(rt)->jniDeallocator);
 
-#define CONVERT(arg, type, index) \
+  // Arguments converted to ArrayBuffers are classified all at once, the owner never is.
+  size_t jsArgsCount = info.takesOwner ? count - 1 : count;
+  std::vector<std::optional<TypedArrayKind>> typedArrayKinds = argumentsConverter.takesTypedArrays()
+    ? getTypedArrayKinds(rt, args, jsArgsCount)
+    : std::vector<std::optional<TypedArrayKind>>();
+
+#define CONVERT(arg, index, typedArrayKind) \
 try {                             \
-  auto converterValue = type->converter->convert(rt, env, arg); \
+  auto converterValue = argumentsConverter.convert(index, rt, env, arg, typedArrayKind); \
   env->SetObjectArrayElement(argumentArray, index, converterValue); \
   env->DeleteLocalRef(converterValue);                          \
 } catch (std::exception &exception) {                           \
@@ -79,32 +208,67 @@ try {                             \
   );                              \
 }
 
+  auto typedArrayKindAt = [&typedArrayKinds](size_t jsArgIndex) -> std::optional<TypedArrayKind> {
+    return jsArgIndex < typedArrayKinds.size() ? typedArrayKinds[jsArgIndex] : std::nullopt;
+  };
+
   if (!info.takesOwner) {
     for (size_t argIndex = 0; argIndex < count; argIndex++) {
       const jsi::Value &arg = args[argIndex];
-      auto &type = info.argTypes[argIndex];
-      CONVERT(arg, type, argIndex)
+      CONVERT(arg, argIndex, typedArrayKindAt(argIndex))
     }
   } else {
-    auto &thisType = info.argTypes[0];
-    CONVERT(thisValue, thisType, 0)
+    CONVERT(thisValue, 0, std::nullopt)
 
     for (size_t argIndex = 1; argIndex < count; argIndex++) {
       const jsi::Value &arg = args[argIndex - 1];
-      auto &type = info.argTypes[argIndex];
-      CONVERT(arg, type, argIndex)
+      CONVERT(arg, argIndex, typedArrayKindAt(argIndex - 1))
     }
   }
 #undef CONVERT
 
-  return argumentArray;
+  deallocatorBatch.flush();
+}
+
+/**
+ * Checks whether the argument of the given type can be passed to the `JNIPrimitiveFunctionBody`.
+ */
+bool isPrimitiveArgType(CppType type) {
+  switch (type) {
+    case CppType::DOUBLE:
+    case CppType::INT:
+    case CppType::LONG:
+    case CppType::FLOAT:
+    case CppType::BOOLEAN:
+      return true;
+    default:
+      return false;
+  }
 }
 
 MethodMetadata::MethodMetadata(
   Info info,
   jni::global_ref<jobject> &&jBodyReference
 ) : info(std::move(info)),
-    jBodyReference(std::move(jBodyReference)) {
+    jBodyReference(std::move(jBodyReference)),
+    argumentsConverter(this->info.argTypes),
+    // Room for the converted arguments, the result and a few references created while converting it.
+    localFrameCapacity(static_cast<int>(this->info.argTypes.size()) + 4) {
+  if (this->info.isAsync || this->info.takesOwner || this->jBodyReference == nullptr) {
+    return;
+  }
+  if (this->info.argTypes.size() > JNIPrimitiveFunctionBody::maxArgsCount) {
+    return;
+  }
+  for (const auto &argType: this->info.argTypes) {
+    if (!isPrimitiveArgType(argType->cppType)) {
+      return;
+    }
+  }
+  acceptsPrimitiveArgs = jni::Environment::current()->IsInstanceOf(
+    this->jBodyReference.get(),
+    JNIPrimitiveFunctionBody::javaClassStatic().get()
+  );
 }
 
 std::shared_ptr<jsi::Function> MethodMetadata::toJSFunction(
@@ -168,10 +332,93 @@ jni::local_ref<jobject> MethodMetadata::callJNISync(
     return nullptr;
   }
 
-  auto convertedArgs = convertJSIArgsToJNI(env, rt, thisValue, args, count);
-  auto result = JNIFunctionBody::invoke(this->jBodyReference.get(), convertedArgs);
-  env->DeleteLocalRef(convertedArgs);
-  return result;
+  callStats.calls.fetch_add(1, std::memory_order_relaxed);
+
+  if (acceptsPrimitiveArgs) {
+    jni::local_ref<jobject> result;
+    if (tryCallJNIWithPrimitives(args, count, result)) {
+      callStats.primitiveCalls.fetch_add(1, std::memory_order_relaxed);
+      return result;
+    }
+  }
+
+  // Missing optional arguments are filled by the Kotlin part, which needs an array of the exact size,
+  // so only complete calls can reuse the array. The same goes for nested calls of this function.
+  size_t argsCount = getJNIArgsCount(count);
+  if (argsCount != info.argTypes.size() || isArgsArrayInUse.exchange(true, std::memory_order_acquire)) {
+    auto convertedArgs = convertJSIArgsToJNI(env, rt, thisValue, args, count);
+    auto result = JNIFunctionBody::invoke(this->jBodyReference.get(), convertedArgs);
+    env->DeleteLocalRef(convertedArgs);
+    return result;
+  }
+
+  struct ArgsArrayLease {
+    JNIEnv *env;
+    jobjectArray array;
+    size_t size;
+    std::atomic<bool> &isInUse;
+
+    ~ArgsArrayLease() {
+      // Don't keep the arguments alive until the next call.
+      for (size_t i = 0; i < size; i++) {
+        env->SetObjectArrayElement(array, i, nullptr);
+      }
+      isInUse.store(false, std::memory_order_release);
+    }
+  };
+
+  if (reusableArgsArray == nullptr) {
+    auto array = env->NewObjectArray(argsCount, JCacheHolder::get().jObject, nullptr);
+    reusableArgsArray = jni::make_global(jni::adopt_local(static_cast<jobject>(array)));
+    callStats.allocatedArgsArrays.fetch_add(1, std::memory_order_relaxed);
+  } else {
+    callStats.reusedArgsArrays.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  auto argumentArray = static_cast<jobjectArray>(reusableArgsArray.get());
+  ArgsArrayLease lease{env, argumentArray, argsCount, isArgsArrayInUse};
+  writeJSIArgsToJNI(env, rt, thisValue, args, count, argumentArray);
+  return JNIFunctionBody::invoke(this->jBodyReference.get(), argumentArray);
+}
+
+MethodMetadata::CallStats MethodMetadata::getCallStats() const {
+  return {
+    .calls = callStats.calls.load(std::memory_order_relaxed),
+    .primitiveCalls = callStats.primitiveCalls.load(std::memory_order_relaxed),
+    .reusedArgsArrays = callStats.reusedArgsArrays.load(std::memory_order_relaxed),
+    .allocatedArgsArrays = callStats.allocatedArgsArrays.load(std::memory_order_relaxed)
+  };
+}
+
+bool MethodMetadata::tryCallJNIWithPrimitives(
+  const jsi::Value *args,
+  size_t count,
+  jni::local_ref<jobject> &result
+) {
+  // Optional arguments and invalid arguments are handled by the regular path,
+  // which knows how to fill the missing values and how to report errors.
+  if (count != info.argTypes.size()) {
+    return false;
+  }
+
+  jdouble primitiveArgs[JNIPrimitiveFunctionBody::maxArgsCount];
+  for (size_t i = 0; i < count; i++) {
+    const jsi::Value &arg = args[i];
+    if (info.argTypes[i]->cppType == CppType::BOOLEAN) {
+      if (!arg.isBool()) {
+        return false;
+      }
+      primitiveArgs[i] = arg.getBool() ? 1.0 : 0.0;
+    } else {
+      if (!arg.isNumber()) {
+        return false;
+      }
+      primitiveArgs[i] = arg.getNumber();
+    }
+  }
+
+  result = JNIPrimitiveFunctionBody::invoke(this->jBodyReference.get(), primitiveArgs, count);
+  return true;
 }
 
 jsi::Value MethodMetadata::callSync(
@@ -186,7 +433,7 @@ jsi::Value MethodMetadata::callSync(
   * function call. When the stack frame for this lambda is popped,
   * all LocalReferences are deleted.
   */
-  jni::JniLocalScope scope(env, (int) count);
+  jni::JniLocalScope scope(env, localFrameCapacity);
 
   auto result = this->callJNISync(env, rt, thisValue, args, count);
   return convert(env, rt, this->info.returnType, result);
@@ -219,117 +466,95 @@ jsi::Function MethodMetadata::toAsyncFunction(
        * function call. When the stack frame for this lambda is popped,
        * all LocalReferences are deleted.
        */
-      jni::JniLocalScope scope(env, (int) count);
+      jni::JniLocalScope scope(env, thisPtr->localFrameCapacity);
 
       auto &Promise = jsiContext->jsRegistry->getObject<jsi::Function>(
         JSReferencesCache::JSKeys::PROMISE
       );
+      auto &promiseFactory = common::getRuntimeCache<PromiseFactory>(rt);
 
+      jobjectArray globalConvertedArgs;
       try {
         auto convertedArgs = thisPtr->convertJSIArgsToJNI(env, rt, thisValue, args, count);
-        auto globalConvertedArgs = (jobjectArray) env->NewGlobalRef(convertedArgs);
+        globalConvertedArgs = (jobjectArray) env->NewGlobalRef(convertedArgs);
         env->DeleteLocalRef(convertedArgs);
-
-        // Creates a JSI promise
-        jsi::Value promise = Promise.callAsConstructor(
-          rt,
-          thisPtr->createPromiseBody(rt, globalConvertedArgs)
-        );
-        return promise;
       } catch (jni::JniException &jniException) {
-        jni::local_ref<jni::JThrowable> unboxedThrowable = jniException.getThrowable();
-        if (!unboxedThrowable->isInstanceOf(CodedException::javaClassLocal())) {
-          unboxedThrowable = UnexpectedException::create(jniException.what());
-        }
-
-        auto codedException = jni::static_ref_cast<CodedException>(unboxedThrowable);
-        auto code = codedException->getCode();
-        auto message = codedException->getLocalizedMessage().value_or("");
-
-        jsi::Value promise = Promise.callAsConstructor(
-          rt,
-          jsi::Function::createFromHostFunction(
-            rt,
-            jsiContext->jsRegistry->getPropNameID(rt, "promiseFn"),
-            2,
-            [code, message](
-              jsi::Runtime &rt,
-              const jsi::Value &thisVal,
-              const jsi::Value *promiseConstructorArgs,
-              size_t promiseConstructorArgCount
-            ) {
-              if (promiseConstructorArgCount != 2) {
-                throw std::invalid_argument("Promise fn arg count must be 2");
-              }
-
-              jsi::Function rejectJSIFn = promiseConstructorArgs[1].getObject(rt).getFunction(rt);
-              rejectJSIFn.call(
-                rt,
-                makeCodedError(
-                  rt,
-                  jsi::String::createFromUtf8(rt, code),
-                  jsi::String::createFromUtf8(rt, message)
-                )
-              );
-              return jsi::Value::undefined();
-            }
-          )
-        );
-
-        return promise;
+        auto deferred = promiseFactory.create(rt, Promise);
+        rejectWithCodedError(rt, deferred.reject, getCodedErrorInfo(jniException));
+        return std::move(deferred.promise);
       }
+
+      // Creates a JSI promise
+      auto deferred = promiseFactory.create(rt, Promise);
+      thisPtr->callJNIAsync(
+        rt,
+        std::move(deferred.resolve),
+        std::move(deferred.reject),
+        globalConvertedArgs
+      );
+      return std::move(deferred.promise);
     }
   );
 }
 
-jsi::Function MethodMetadata::createPromiseBody(
+void MethodMetadata::callJNIAsync(
   jsi::Runtime &runtime,
+  jsi::Function &&resolve,
+  jsi::Function &&reject,
   jobjectArray globalArgs
 ) {
-  return jsi::Function::createFromHostFunction(
-    runtime,
-    getJSIContext(runtime)->jsRegistry->getPropNameID(runtime, "promiseFn"),
-    2,
-    [this, globalArgs](
-      jsi::Runtime &rt,
-      const jsi::Value &thisVal,
-      const jsi::Value *promiseConstructorArgs,
-      size_t promiseConstructorArgCount
-    ) {
-      if (promiseConstructorArgCount != 2) {
-        throw std::invalid_argument("Promise fn arg count must be 2");
-      }
-
-      jsi::Function resolveJSIFn = promiseConstructorArgs[0].getObject(rt).getFunction(rt);
-      jsi::Function rejectJSIFn = promiseConstructorArgs[1].getObject(rt).getFunction(rt);
-
-      jobject javaCallback = createJavaCallback(
-        std::move(resolveJSIFn),
-        std::move(rejectJSIFn),
-        rt
-      ).release();
+  JNIEnv *env = jni::Environment::current();
 
-      JNIEnv *env = jni::Environment::current();
+  // The arguments are released in every path, also when calling the function fails.
+  struct GlobalArgsGuard {
+    JNIEnv *env;
+    jobjectArray globalArgs;
 
-      auto &jPromise = JCacheHolder::get().jPromise;
+    ~GlobalArgsGuard() {
+      env->DeleteGlobalRef(globalArgs);
+    }
+  } globalArgsGuard{env, globalArgs};
 
-      // Creates a promise object
-      jobject promise = env->NewObject(
-        jPromise.clazz,
-        jPromise.constructor,
-        javaCallback
-      );
+  auto callbackContext = createCallbackContext(
+    std::move(resolve),
+    std::move(reject),
+    runtime
+  );
+  jobject javaCallback = JavaCallback::newInstance(getJSIContext(runtime), callbackContext).release();
 
-      JNIAsyncFunctionBody::invoke(this->jBodyReference.get(), globalArgs, promise);
+  auto &jPromise = JCacheHolder::get().jPromise;
 
-      // We have to remove the local reference to the promise object.
-      // It doesn't mean that the promise will be deallocated, but rather that we move
-      // the ownership to the `JNIAsyncFunctionBody`.
-      env->DeleteLocalRef(promise);
-      env->DeleteGlobalRef(globalArgs);
+  // Creates a promise object
+  jobject promise = env->NewObject(
+    jPromise.clazz,
+    jPromise.constructor,
+    javaCallback
+  );
 
-      return jsi::Value::undefined();
+  try {
+    JNIAsyncFunctionBody::invoke(this->jBodyReference.get(), globalArgs, promise);
+  } catch (jni::JniException &jniException) {
+    env->DeleteLocalRef(promise);
+
+    // The rejection goes through the settlement queue, so it's ignored
+    // if the function settled the promise before throwing.
+    if (auto settlementQueue = callbackContext->settlementQueueHolder.lock()) {
+      settlementQueue->enqueue(
+        [callbackContext, error = getCodedErrorInfo(jniException)](jsi::Runtime &rt) {
+          if (!callbackContext->rejectHolder.has_value()) {
+            return;
+          }
+          rejectWithCodedError(rt, *callbackContext->rejectHolder, error);
+          callbackContext->invalidate();
+        }
+      );
     }
-  );
+    return;
+  }
+
+  // We have to remove the local reference to the promise object.
+  // It doesn't mean that the promise will be deallocated, but rather that we move
+  // the ownership to the `JNIAsyncFunctionBody`.
+  env->DeleteLocalRef(promise);
 }
 } // namespace expo
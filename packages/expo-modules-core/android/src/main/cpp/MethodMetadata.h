@@ -7,6 +7,9 @@
 #include "types/ExpectedType.h"
 #include "types/AnyType.h"
 #include "types/ReturnType.h"
+#include "types/ArgumentsConverter.h"
+
+#include <atomic>
 
 namespace jni = facebook::jni;
 namespace jsi = facebook::jsi;
@@ -47,6 +50,30 @@ public:
     ReturnType returnType = ReturnType::UNKNOWN;
   };
 
+  /**
+   * A snapshot of the counters describing how the function was called.
+   */
+  struct CallStats {
+    /**
+     * Number of synchronous calls.
+     */
+    uint64_t calls;
+    /**
+     * Number of synchronous calls that passed unboxed arguments.
+     */
+    uint64_t primitiveCalls;
+    /**
+     * Number of calls that reused the arguments array.
+     */
+    uint64_t reusedArgsArrays;
+    /**
+     * Number of calls that had to allocate a new arguments array. Only one synchronous call at a time can use
+     * the reusable array, so nested and concurrent calls allocate their own arrays, as well as asynchronous calls
+     * and calls that omit optional arguments.
+     */
+    uint64_t allocatedArgsArrays;
+  };
+
   Info info;
 
   MethodMetadata(
@@ -57,7 +84,8 @@ public:
   // We deleted the copy contractor to not deal with transforming the ownership of the `jBodyReference`.
   MethodMetadata(const MethodMetadata &) = delete;
 
-  MethodMetadata(MethodMetadata &&other) = default;
+  // The metadata is shared through `std::shared_ptr` and can't be moved, as the call counters are atomic.
+  MethodMetadata(MethodMetadata &&) = delete;
 
   /**
    * Transforms metadata to a jsi::Function.
@@ -87,6 +115,11 @@ public:
     size_t count
   );
 
+  /**
+   * Returns a snapshot of the call counters.
+   */
+  CallStats getCallStats() const;
+
 private:
   /**
    * Reference to one of two java objects - `JNIFunctionBody` or `JNIAsyncFunctionBody`.
@@ -96,6 +129,38 @@ private:
    */
   jni::global_ref<jobject> jBodyReference;
 
+  /**
+   * Whether the body implements `JNIPrimitiveFunctionBody`, so numbers and booleans
+   * can be passed through JNI without boxing them and creating the arguments array.
+   */
+  bool acceptsPrimitiveArgs = false;
+
+  /**
+   * Conversion routines for the arguments, selected when the function is registered.
+   */
+  const ArgumentsConverter argumentsConverter;
+
+  /**
+   * Capacity of the JNI local frame pushed for each call.
+   */
+  const int localFrameCapacity;
+
+  /**
+   * The arguments array reused by synchronous calls that pass all arguments.
+   * It's created lazily and can be used by one call at a time, other calls allocate their own arrays.
+   * It's shared by all threads rather than kept per thread, as functions are almost always called on the JS thread.
+   * Asynchronous calls always allocate their arrays, since they're passed to Kotlin and outlive the call.
+   */
+  jni::global_ref<jobject> reusableArgsArray;
+  std::atomic<bool> isArgsArrayInUse = false;
+
+  struct {
+    std::atomic<uint64_t> calls = 0;
+    std::atomic<uint64_t> primitiveCalls = 0;
+    std::atomic<uint64_t> reusedArgsArrays = 0;
+    std::atomic<uint64_t> allocatedArgsArrays = 0;
+  } callStats;
+
   /**
    * To not create a jsi::Function always when we need it, we cached that value.
    */
@@ -105,11 +170,28 @@ private:
 
   jsi::Function toAsyncFunction(jsi::Runtime &runtime);
 
-  jsi::Function createPromiseBody(
+  /**
+   * Calls the underlying Kotlin function with a promise that is settled using the given functions.
+   * When the call throws, the promise is rejected unless the function already settled it. Takes ownership of `globalArgs`.
+   */
+  void callJNIAsync(
     jsi::Runtime &runtime,
+    jsi::Function &&resolve,
+    jsi::Function &&reject,
     jobjectArray globalArgs
   );
 
+  /**
+   * Tries to call the underlying Kotlin function with unboxed arguments.
+   * Returns `false` when the arguments don't match the expected primitive types,
+   * so the function has to be called using the regular path.
+   */
+  bool tryCallJNIWithPrimitives(
+    const jsi::Value *args,
+    size_t count,
+    jni::local_ref<jobject> &result
+  );
+
   jobjectArray convertJSIArgsToJNI(
     JNIEnv *env,
     jsi::Runtime &rt,
@@ -117,5 +199,23 @@ private:
     const jsi::Value *args,
     size_t count
   );
+
+  /**
+   * Returns the size of the arguments array passed to Kotlin.
+   * Throws when there are more arguments than the function accepts.
+   */
+  size_t getJNIArgsCount(size_t count) const;
+
+  /**
+   * Converts the arguments and stores them in the given array, which has to be big enough to hold them.
+   */
+  void writeJSIArgsToJNI(
+    JNIEnv *env,
+    jsi::Runtime &rt,
+    const jsi::Value &thisValue,
+    const jsi::Value *args,
+    size_t count,
+    jobjectArray argumentArray
+  );
 };
 } // namespace expo
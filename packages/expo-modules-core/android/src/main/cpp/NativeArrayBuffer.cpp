@@ -1,6 +1,8 @@
 #include "NativeArrayBuffer.h"
 
+#include "DirectBufferPool.h"
 #include "JavaScriptRuntime.h"
+#include "JNIWorkerPool.h"
 #include "JSIContext.h"
 
 namespace expo {
@@ -19,7 +21,7 @@ ByteBufferJSIWrapper::ByteBufferJSIWrapper(
 
 ByteBufferJSIWrapper::~ByteBufferJSIWrapper() {
   // Destruction can happen on JS thread
-  jni::ThreadScope::WithClassLoader([&] { _byteBuffer.reset(); });
+  JNIWorkerPool::shared().release(std::move(_byteBuffer));
 }
 
 uint8_t *ByteBufferJSIWrapper::data() {
@@ -45,9 +47,18 @@ void NativeArrayBuffer::registerNatives() {
                    makeNativeMethod("readFloat", NativeArrayBuffer::read<float>),
                    makeNativeMethod("readDouble", NativeArrayBuffer::read<double>),
                    makeNativeMethod("toDirectBuffer", NativeArrayBuffer::toDirectBuffer),
+                   makeNativeMethod("allocatePooledNative", NativeArrayBuffer::allocatePooled),
                  });
 }
 
+jni::local_ref<NativeArrayBuffer::javaobject> NativeArrayBuffer::allocatePooled(
+  [[maybe_unused]] jni::alias_ref<jni::JClass> clazz,
+  jint size
+) {
+  auto pooledBuffer = DirectBufferPool::acquire(static_cast<size_t>(size), true);
+  return NativeArrayBuffer::newObjectCxxArgs(pooledBuffer.byteBuffer, std::move(pooledBuffer.memory));
+}
+
 jni::local_ref<NativeArrayBuffer::jhybriddata>
 NativeArrayBuffer::initHybrid(jni::alias_ref<JavaPart::javaobject>,
                               jni::alias_ref<jni::JByteBuffer> byteBuffer) {
@@ -67,11 +78,10 @@ NativeArrayBuffer::newInstance(JSIContext *jsiContext, jsi::Runtime &runtime,
   }
 
   size_t size = arrayBuffer.size(runtime);
-  auto byteBuffer = jni::JByteBuffer::allocateDirect(size);
-  byteBuffer->order(jni::JByteOrder::nativeOrder());
-  memcpy(byteBuffer->getDirectAddress(), arrayBuffer.data(runtime), size);
+  auto pooledBuffer = DirectBufferPool::acquire(size);
+  memcpy(pooledBuffer.memory->data(), arrayBuffer.data(runtime), size);
 
-  auto value = NativeArrayBuffer::newObjectCxxArgs(byteBuffer);
+  auto value = NativeArrayBuffer::newObjectCxxArgs(pooledBuffer.byteBuffer, std::move(pooledBuffer.memory));
   jsiContext->jniDeallocator->addReference(value);
   return value;
 }
@@ -93,11 +103,10 @@ NativeArrayBuffer::newInstance(JSIContext *jsiContext, jsi::Runtime &runtime,
     return value;
   }
 
-  auto byteBuffer = jni::JByteBuffer::allocateDirect(static_cast<jint>(size));
-  byteBuffer->order(jni::JByteOrder::nativeOrder());
-  memcpy(byteBuffer->getDirectAddress(), typedArray.getRawPointer(runtime), size);
+  auto pooledBuffer = DirectBufferPool::acquire(size);
+  memcpy(pooledBuffer.memory->data(), typedArray.getRawPointer(runtime), size);
 
-  auto value = NativeArrayBuffer::newObjectCxxArgs(byteBuffer);
+  auto value = NativeArrayBuffer::newObjectCxxArgs(pooledBuffer.byteBuffer, std::move(pooledBuffer.memory));
   jsiContext->jniDeallocator->addReference(value);
   return value;
 }
@@ -54,9 +54,17 @@ public:
     jni::alias_ref<jni::JByteBuffer> byteBuffer
   );
 
+  /**
+   * Creates a zero-filled NativeArrayBuffer backed by a block from the `DirectBufferPool`.
+   */
+  static jni::local_ref<NativeArrayBuffer::javaobject> allocatePooled(
+    jni::alias_ref<jni::JClass> clazz,
+    jint size
+  );
+
   /**
    * Creates a NativeArrayBuffer from the given ArrayBuffer. Uses zero-copy when the
-   * buffer is native-backed (tryGetMutableBuffer), otherwise copies the data.
+   * buffer is native-backed (tryGetMutableBuffer), otherwise copies the data into a pooled buffer.
    */
   static jni::local_ref<NativeArrayBuffer::javaobject> newInstance(
     JSIContext *jsiContext,
@@ -0,0 +1,65 @@
+// Copyright © 2026-present 650 Industries, Inc. (aka Expo)
+
+#include "PromiseSettlementQueue.h"
+
+#include <exception>
+
+namespace expo {
+
+PromiseSettlementQueue::PromiseSettlementQueue(Scheduler scheduler) : scheduler(std::move(scheduler)) {}
+
+void PromiseSettlementQueue::enqueue(Settlement settlement) {
+  {
+    std::lock_guard lock(mutex);
+
+    if (!isValid) {
+      return;
+    }
+
+    settlements.push_back(std::move(settlement));
+
+    if (isDrainScheduled) {
+      return;
+    }
+    isDrainScheduled = true;
+  }
+
+  scheduler([weakThis = weak_from_this()](jsi::Runtime &runtime) {
+    if (auto self = weakThis.lock()) {
+      self->drain(runtime);
+    }
+  });
+}
+
+void PromiseSettlementQueue::drain(jsi::Runtime &runtime) {
+  {
+    std::lock_guard lock(mutex);
+    std::swap(settlements, drainingSettlements);
+    isDrainScheduled = false;
+  }
+
+  // Every promise has to be settled, so errors are deferred until the whole batch is done.
+  std::exception_ptr firstError;
+  for (Settlement &settlement : drainingSettlements) {
+    try {
+      settlement(runtime);
+    } catch (...) {
+      if (!firstError) {
+        firstError = std::current_exception();
+      }
+    }
+  }
+  drainingSettlements.clear();
+
+  if (firstError) {
+    std::rethrow_exception(firstError);
+  }
+}
+
+void PromiseSettlementQueue::invalidate() noexcept {
+  std::lock_guard lock(mutex);
+  isValid = false;
+  settlements.clear();
+}
+
+} // namespace expo
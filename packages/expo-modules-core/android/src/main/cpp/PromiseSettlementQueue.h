@@ -0,0 +1,68 @@
+// Copyright © 2026-present 650 Industries, Inc. (aka Expo)
+
+#pragma once
+
+#include "ExpoHeader.pch"
+
+#include <functional>
+#include <mutex>
+#include <vector>
+
+namespace jsi = facebook::jsi;
+
+namespace expo {
+
+/**
+ * A queue that collects results of asynchronous functions completed on any thread
+ * and settles their promises in batches. Instead of scheduling a separate JS task
+ * for every resolve or reject, the queue schedules one drain for all settlements
+ * that were enqueued until the drain runs.
+ */
+class PromiseSettlementQueue : public std::enable_shared_from_this<PromiseSettlementQueue> {
+public:
+  /**
+   * Settles a single promise. It's invoked on the JS thread.
+   */
+  using Settlement = std::function<void(jsi::Runtime &runtime)>;
+
+  /**
+   * Schedules the given task on the JS thread.
+   */
+  using Scheduler = std::function<void(std::function<void(jsi::Runtime &runtime)> &&task)>;
+
+  explicit PromiseSettlementQueue(Scheduler scheduler);
+
+  /**
+   * Adds a settlement to the queue and schedules a drain unless one is already scheduled. Thread-safe.
+   */
+  void enqueue(Settlement settlement);
+
+  /**
+   * Runs all queued settlements. Must be called on the JS thread.
+   * A settlement that throws doesn't prevent the others from running, the first error is rethrown at the end.
+   */
+  void drain(jsi::Runtime &runtime);
+
+  /**
+   * Drops queued settlements. Settlements enqueued after this call are ignored.
+   */
+  void invalidate() noexcept;
+
+private:
+  std::mutex mutex;
+  Scheduler scheduler;
+  bool isDrainScheduled = false;
+  bool isValid = true;
+
+  /**
+   * Settlements waiting for the next drain.
+   */
+  std::vector<Settlement> settlements;
+
+  /**
+   * Settlements that are being run. Only accessed on the JS thread; swapped with `settlements` so both keep their capacity.
+   */
+  std::vector<Settlement> drainingSettlements;
+};
+
+} // namespace expo
@@ -0,0 +1,67 @@
+// Copyright © 2026-present 650 Industries, Inc. (aka Expo)
+
+#include "PromiseSettlementQueueTester.h"
+
+#include <stdexcept>
+#include <string>
+
+namespace expo {
+
+void PromiseSettlementQueueTester::registerNatives() {
+  registerHybrid({
+                   makeNativeMethod("initHybrid", PromiseSettlementQueueTester::initHybrid),
+                   makeNativeMethod("enqueue", PromiseSettlementQueueTester::enqueue),
+                   makeNativeMethod("runScheduledDrains", PromiseSettlementQueueTester::runScheduledDrains),
+                   makeNativeMethod("getSettledIds", PromiseSettlementQueueTester::getSettledIds),
+                 });
+}
+
+jni::local_ref<PromiseSettlementQueueTester::jhybriddata> PromiseSettlementQueueTester::initHybrid(
+  jni::alias_ref<jhybridobject> jThis
+) {
+  return makeCxxInstance();
+}
+
+PromiseSettlementQueueTester::PromiseSettlementQueueTester() {
+  queue = std::make_shared<PromiseSettlementQueue>(
+    [this](std::function<void(jsi::Runtime &)> &&task) {
+      std::lock_guard lock(mutex);
+      scheduledDrains.push_back(std::move(task));
+    }
+  );
+}
+
+void PromiseSettlementQueueTester::enqueue(int id, bool shouldThrow) {
+  queue->enqueue([this, id, shouldThrow](jsi::Runtime &) {
+    {
+      std::lock_guard lock(mutex);
+      settledIds.push_back(id);
+    }
+    if (shouldThrow) {
+      throw std::runtime_error("Settlement " + std::to_string(id) + " has failed");
+    }
+  });
+}
+
+int PromiseSettlementQueueTester::runScheduledDrains(jlong runtimePointer) {
+  jsi::Runtime &runtime = *reinterpret_cast<jsi::Runtime *>(runtimePointer);
+  std::vector<std::function<void(jsi::Runtime &)>> drains;
+  {
+    std::lock_guard lock(mutex);
+    std::swap(drains, scheduledDrains);
+  }
+
+  for (auto &drain: drains) {
+    drain(runtime);
+  }
+  return static_cast<int>(drains.size());
+}
+
+jni::local_ref<jni::JArrayInt> PromiseSettlementQueueTester::getSettledIds() {
+  std::lock_guard lock(mutex);
+  auto result = jni::JArrayInt::newArray(settledIds.size());
+  result->setRegion(0, static_cast<jsize>(settledIds.size()), settledIds.data());
+  return result;
+}
+
+} // namespace expo
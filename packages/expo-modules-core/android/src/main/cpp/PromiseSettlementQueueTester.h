@@ -0,0 +1,55 @@
+// Copyright © 2026-present 650 Industries, Inc. (aka Expo)
+
+#pragma once
+
+#include "ExpoHeader.pch"
+#include "PromiseSettlementQueue.h"
+
+#include <mutex>
+#include <vector>
+
+namespace jni = facebook::jni;
+namespace jsi = facebook::jsi;
+
+namespace expo {
+
+/**
+ * Exposes a `PromiseSettlementQueue` to the instrumented tests.
+ * Drains are collected instead of being scheduled on the JS thread, so the tests decide when they run.
+ * Settlements record their IDs instead of settling promises.
+ */
+class PromiseSettlementQueueTester : public jni::HybridClass<PromiseSettlementQueueTester> {
+public:
+  static auto constexpr
+    kJavaDescriptor = "Lexpo/modules/kotlin/jni/tests/PromiseSettlementQueueTester;";
+  static auto constexpr TAG = "PromiseSettlementQueueTester";
+
+  static jni::local_ref<jhybriddata> initHybrid(jni::alias_ref<jhybridobject> jThis);
+
+  static void registerNatives();
+
+  /**
+   * Enqueues a settlement that records the given ID or throws if `shouldThrow` is set.
+   */
+  void enqueue(int id, bool shouldThrow);
+
+  /**
+   * Runs the scheduled drains in the given runtime and returns how many of them were run.
+   */
+  int runScheduledDrains(jlong runtimePointer);
+
+  jni::local_ref<jni::JArrayInt> getSettledIds();
+
+private:
+  friend HybridBase;
+
+  PromiseSettlementQueueTester();
+
+  std::shared_ptr<PromiseSettlementQueue> queue;
+
+  std::mutex mutex;
+  std::vector<std::function<void(jsi::Runtime &runtime)>> scheduledDrains;
+  std::vector<int> settledIds;
+};
+
+} // namespace expo
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "ExpoHeader.pch"
+#include "JNIWorkerPool.h"
 #include <android/log.h>
 
 namespace jni = facebook::jni;
@@ -28,19 +29,18 @@ public:
       return;
     }
 
-    jni::ThreadScope::WithClassLoader([this, action = std::move(action)]() {
-      jni::alias_ref<jobject> aliasRef = jni::wrap_alias(globalRef);
-      jni::alias_ref<T> jsiContextRef = jni::static_ref_cast<T>(aliasRef);
-      action(jsiContextRef);
+    // Threads that aren't attached to the JVM hand the action over to the always attached workers.
+    JNIWorkerPool::shared().runAttached([this, &action]() {
+      jni::ThreadScope::WithClassLoader([this, &action]() {
+        jni::alias_ref<jobject> aliasRef = jni::wrap_alias(globalRef);
+        jni::alias_ref<T> jsiContextRef = jni::static_ref_cast<T>(aliasRef);
+        action(jsiContextRef);
+      });
     });
   }
 
   ~ThreadSafeJNIGlobalRef() {
-    if (globalRef != nullptr) {
-      jni::ThreadScope::WithClassLoader([this] {
-        jni::Environment::current()->DeleteGlobalRef(this->globalRef);
-      });
-    }
+    JNIWorkerPool::shared().release(globalRef);
   }
 
   jobject globalRef;
@@ -185,6 +185,15 @@ void JSClassesDecorator::decorate(
   }
 }
 
+std::vector<std::string> JSClassesDecorator::getMemberNames() const {
+  std::vector<std::string> names;
+  names.reserve(classes.size());
+  for (const auto &[name, _]: classes) {
+    names.push_back(name);
+  }
+  return names;
+}
+
 jsi::Function JSClassesDecorator::createClass(
   jsi::Runtime &runtime,
   const std::string &className,
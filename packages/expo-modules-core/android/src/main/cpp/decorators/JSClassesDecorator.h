@@ -45,6 +45,8 @@ public:
     jsi::Object &jsObject
   ) override;
 
+  std::vector<std::string> getMemberNames() const override;
+
   /**
    * Worklet runtime path - installs classes in classRegistry, transfers
    * decorator ownership to each prototype via NativeState, and drains this
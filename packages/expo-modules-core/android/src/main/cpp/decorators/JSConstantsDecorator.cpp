@@ -30,6 +30,40 @@ void JSConstantsDecorator::registerConstant(
   constants.insert_or_assign(cName, jni::make_global(getter));
 }
 
+jsi::Object JSConstantsDecorator::createDescriptor(
+  jsi::Runtime &runtime,
+  const jsi::PropNameID &propName,
+  jni::global_ref<JNINoArgsFunctionBody::javaobject> getter
+) {
+  auto descriptor = JavaScriptObject::preparePropertyDescriptor(runtime,
+                                                                1 << 1 /* enumerable */);
+  jsi::Function jsiFunc = jsi::Function::createFromHostFunction(
+    runtime,
+    propName,
+    0,
+    [getterFunc = std::move(getter), prevValue = std::shared_ptr<jsi::Value>()](
+      jsi::Runtime &rt,
+      const jsi::Value &thisValue,
+      const jsi::Value *args,
+      size_t count
+    ) mutable -> jsi::Value {
+      if (prevValue == nullptr) {
+        JNIEnv *env = jni::Environment::current();
+        auto result = JNINoArgsFunctionBody::invoke(getterFunc.get());
+        getterFunc = nullptr;
+        prevValue = std::make_shared<jsi::Value>(convert(env, rt, result));
+      }
+      return {rt, *prevValue};
+    });
+
+  descriptor.setProperty(
+    runtime,
+    "get",
+    jsi::Value(runtime, jsiFunc)
+  );
+  return descriptor;
+}
+
 void JSConstantsDecorator::decorate(
   jsi::Runtime &runtime,
   jsi::Object &jsObject
@@ -42,37 +76,61 @@ void JSConstantsDecorator::decorate(
     );
   }
 
+  if (this->constants.empty()) {
+    return;
+  }
+
+  auto jsRegistry = getJSIContext(runtime)->jsRegistry.get();
+  // Collect all descriptors first to define the constants with a single `Object.defineProperties` call.
+  jsi::Object descriptors(runtime);
+
   for (auto &[name, getter]: this->constants) {
-    auto descriptor = JavaScriptObject::preparePropertyDescriptor(runtime,
-                                                                  1 << 1 /* enumerable */);
-    jsi::Function jsiFunc = jsi::Function::createFromHostFunction(
-      runtime,
-      getJSIContext(runtime)->jsRegistry->getPropNameID(runtime, name),
-      0,
-      [getterFunc = std::move(getter), prevValue = std::shared_ptr<jsi::Value>()](
-        jsi::Runtime &rt,
-        const jsi::Value &thisValue,
-        const jsi::Value *args,
-        size_t count
-      ) mutable -> jsi::Value {
-        if (prevValue == nullptr) {
-          JNIEnv *env = jni::Environment::current();
-          auto result = JNINoArgsFunctionBody::invoke(getterFunc.get());
-          getterFunc = nullptr;
-          prevValue = std::make_shared<jsi::Value>(convert(env, rt, result));
-        }
-        return {rt, *prevValue};
-      });
-
-    descriptor.setProperty(
+    const auto &propName = jsRegistry->getPropNameID(runtime, name);
+    descriptors.setProperty(runtime, propName, createDescriptor(runtime, propName, std::move(getter)));
+  }
+  this->constants.clear();
+
+  common::defineProperties(runtime, &jsObject, std::move(descriptors));
+}
+
+bool JSConstantsDecorator::decorateMember(
+  jsi::Runtime &runtime,
+  jsi::Object &jsObject,
+  const std::string &name
+) {
+  bool found = false;
+
+  if (auto legacyConstant = this->legacyConstants.find(name); legacyConstant != this->legacyConstants.end()) {
+    jsObject.setProperty(
       runtime,
-      "get",
-      jsi::Value(runtime, jsiFunc)
+      jsi::String::createFromUtf8(runtime, name),
+      jsi::valueFromDynamic(runtime, legacyConstant->second)
     );
+    found = true;
+  }
+
+  if (auto constant = this->constants.find(name); constant != this->constants.end()) {
+    const auto &propName = getJSIContext(runtime)->jsRegistry->getPropNameID(runtime, name);
+    auto descriptor = createDescriptor(runtime, propName, std::move(constant->second));
+    // Same as in `decorate`, the getter is moved into the JS function, so it can be defined only once.
+    this->constants.erase(constant);
 
     common::defineProperty(runtime, &jsObject, name.c_str(), std::move(descriptor));
+    found = true;
   }
-  this->constants.clear();
+  return found;
+}
+
+std::vector<std::string> JSConstantsDecorator::getMemberNames() const {
+  std::vector<std::string> names;
+  names.reserve(this->legacyConstants.size() + this->constants.size());
+  for (const auto &[name, _]: this->legacyConstants) {
+    names.push_back(name);
+  }
+  for (const auto &[name, _]: this->constants) {
+    names.push_back(name);
+  }
+  return names;
 }
 
 } // namespace expo
@@ -25,7 +25,25 @@ public:
     jsi::Object &jsObject
   ) override;
 
+  bool supportsMemberDecoration() const override {
+    return true;
+  }
+
+  bool decorateMember(
+    jsi::Runtime &runtime,
+    jsi::Object &jsObject,
+    const std::string &name
+  ) override;
+
+  std::vector<std::string> getMemberNames() const override;
+
 private:
+  static jsi::Object createDescriptor(
+    jsi::Runtime &runtime,
+    const jsi::PropNameID &propName,
+    jni::global_ref<JNINoArgsFunctionBody::javaobject> getter
+  );
+
   /**
   * A constants map.
   */
@@ -22,6 +22,34 @@ public:
     jsi::Runtime &runtime,
     jsi::Object &jsObject
   ) = 0;
+
+  /**
+   * Whether the decorator can define its members one by one using `decorateMember`.
+   * Such decorators can be applied lazily, member by member, as they're accessed.
+   */
+  virtual bool supportsMemberDecoration() const {
+    return false;
+  }
+
+  /**
+   * Defines only the member with the given name on the object.
+   * Returns `false` when the decorator doesn't provide such member.
+   */
+  virtual bool decorateMember(
+    jsi::Runtime &runtime,
+    jsi::Object &jsObject,
+    const std::string &name
+  ) {
+    return false;
+  }
+
+  /**
+   * Returns names of all members that the decorator defines on the object.
+   * For decorators that support member decoration, these can be defined with `decorateMember`.
+   */
+  virtual std::vector<std::string> getMemberNames() const {
+    return {};
+  }
 };
 
 } // namespace expo
@@ -82,6 +82,7 @@ void JSDecoratorsBridgingObject::registerProperty(
   jni::alias_ref<jstring> name,
   jboolean getterTakesOwner,
   jni::alias_ref<jni::JArrayClass<ExpectedType>> getterExpectedArgsTypes,
+  jint getterCppReturnType,
   jni::alias_ref<JNIFunctionBody::javaobject> getter,
   jboolean setterTakesOwner,
   jni::alias_ref<jni::JArrayClass<ExpectedType>> setterExpectedArgsTypes,
@@ -95,6 +96,7 @@ void JSDecoratorsBridgingObject::registerProperty(
     name,
     getterTakesOwner,
     getterExpectedArgsTypes,
+    getterCppReturnType,
     getter,
     setterTakesOwner,
     setterExpectedArgsTypes,
@@ -34,6 +34,7 @@ public:
     jni::alias_ref<jstring> name,
     jboolean getterTakesOwner,
     jni::alias_ref<jni::JArrayClass<ExpectedType>> getterExpectedArgsTypes,
+    jint getterCppReturnType,
     jni::alias_ref<JNIFunctionBody::javaobject> getter,
     jboolean setterTakesOwner,
     jni::alias_ref<jni::JArrayClass<ExpectedType>> setterExpectedArgsTypes,
@@ -4,6 +4,8 @@
 #include "JSFunctionsDecorator.h"
 #include "JSIUtils.h"
 
+#include <optional>
+
 namespace jsi = facebook::jsi;
 
 namespace expo {
@@ -91,6 +93,9 @@ void JSFunctionsDecorator::decorate(
   jsi::Runtime &runtime,
   jsi::Object &jsObject
 ) {
+  // Non-enumerable functions are collected and defined with a single `Object.defineProperties` call.
+  std::optional<jsi::Object> descriptors;
+
   for (auto &[name, method]: this->methodsMetadata) {
     if (method->info.enumerable) {
       jsObject.setProperty(
@@ -104,9 +109,65 @@ void JSFunctionsDecorator::decorate(
         .value = jsi::Value(runtime, *method->toJSFunction(runtime))
       };
 
-      defineProperty(runtime, &jsObject, name.c_str(), descriptor);
+      if (!descriptors) {
+        descriptors.emplace(runtime);
+      }
+      descriptors->setProperty(
+        runtime,
+        jsi::PropNameID::forUtf8(runtime, name),
+        common::createPropertyDescriptor(runtime, descriptor)
+      );
     }
   }
+
+  if (descriptors) {
+    common::defineProperties(runtime, &jsObject, std::move(*descriptors));
+  }
+}
+
+bool JSFunctionsDecorator::decorateMember(
+  jsi::Runtime &runtime,
+  jsi::Object &jsObject,
+  const std::string &name
+) {
+  auto entry = this->methodsMetadata.find(name);
+  if (entry == this->methodsMetadata.end()) {
+    return false;
+  }
+  auto &method = entry->second;
+
+  if (method->info.enumerable) {
+    jsObject.setProperty(
+      runtime,
+      jsi::String::createFromUtf8(runtime, name),
+      jsi::Value(runtime, *method->toJSFunction(runtime))
+    );
+  } else {
+    common::PropertyDescriptor descriptor{
+      .enumerable = false,
+      .value = jsi::Value(runtime, *method->toJSFunction(runtime))
+    };
+
+    defineProperty(runtime, &jsObject, name.c_str(), descriptor);
+  }
+  return true;
+}
+
+std::vector<std::string> JSFunctionsDecorator::getMemberNames() const {
+  std::vector<std::string> names;
+  names.reserve(this->methodsMetadata.size());
+  for (const auto &[name, _]: this->methodsMetadata) {
+    names.push_back(name);
+  }
+  return names;
+}
+
+std::shared_ptr<MethodMetadata> JSFunctionsDecorator::getMethodMetadata(const std::string &name) const {
+  auto metadata = this->methodsMetadata.find(name);
+  if (metadata == this->methodsMetadata.end()) {
+    return nullptr;
+  }
+  return metadata->second;
 }
 
 } // namespace expo
@@ -40,6 +40,23 @@ public:
     jsi::Object &jsObject
   ) override;
 
+  bool supportsMemberDecoration() const override {
+    return true;
+  }
+
+  bool decorateMember(
+    jsi::Runtime &runtime,
+    jsi::Object &jsObject,
+    const std::string &name
+  ) override;
+
+  std::vector<std::string> getMemberNames() const override;
+
+  /**
+   * Returns the metadata of the function with the given name or `nullptr` if there is no such function.
+   */
+  std::shared_ptr<MethodMetadata> getMethodMetadata(const std::string &name) const;
+
   static std::vector<std::unique_ptr<AnyType>> mapConverters(jni::alias_ref<jni::JArrayClass<ExpectedType>> expectedArgTypes);
 
 private:
@@ -31,4 +31,13 @@ void JSObjectDecorator::decorate(
   }
 }
 
+std::vector<std::string> JSObjectDecorator::getMemberNames() const {
+  std::vector<std::string> names;
+  names.reserve(this->objects.size());
+  for (const auto &[name, _]: this->objects) {
+    names.push_back(name);
+  }
+  return names;
+}
+
 } // namespace expo
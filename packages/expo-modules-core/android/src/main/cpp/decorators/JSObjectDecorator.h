@@ -24,6 +24,8 @@ public:
     jsi::Object &jsObject
   ) override;
 
+  std::vector<std::string> getMemberNames() const override;
+
 private:
   std::unordered_map<std::string, std::vector<std::unique_ptr<JSDecorator>>> objects;
 };
@@ -14,6 +14,7 @@ void JSPropertiesDecorator::registerProperty(
   jni::alias_ref<jstring> name,
   jboolean getterTakesOwner,
   jni::alias_ref<jni::JArrayClass<ExpectedType>> getterExpectedArgsTypes,
+  jint getterCppReturnType,
   jni::alias_ref<JNIFunctionBody::javaobject> getter,
   jboolean setterTakesOwner,
   jni::alias_ref<jni::JArrayClass<ExpectedType>> setterExpectedArgsTypes,
@@ -26,7 +27,8 @@ void JSPropertiesDecorator::registerProperty(
     .takesOwner = static_cast<bool>(getterTakesOwner & 0x1),
     .isAsync = false,
     .enumerable = true,
-    .argTypes = JSFunctionsDecorator::mapConverters(getterExpectedArgsTypes)
+    .argTypes = JSFunctionsDecorator::mapConverters(getterExpectedArgsTypes),
+    .returnType = (ReturnType)getterCppReturnType
   };
   auto getterMetadata = std::make_shared<MethodMetadata>(
     std::move(getterInfo),
@@ -54,34 +56,76 @@ void JSPropertiesDecorator::registerProperty(
   properties.insert_or_assign(cName, std::move(functions));
 }
 
+jsi::Object JSPropertiesDecorator::createDescriptor(
+  jsi::Runtime &runtime,
+  const Property &property
+) {
+  auto &[getter, setter] = property;
+
+  auto descriptor = JavaScriptObject::preparePropertyDescriptor(runtime,
+                                                                1 << 1 /* enumerable */);
+  auto jsGetter = getter->toJSFunction(runtime);
+  if (jsGetter != nullptr) {
+    descriptor.setProperty(
+      runtime,
+      "get",
+      jsi::Value(runtime, *jsGetter)
+    );
+  }
+
+  auto jsSetter = setter->toJSFunction(runtime);
+  if (jsSetter != nullptr) {
+    descriptor.setProperty(
+      runtime,
+      "set",
+      jsi::Value(runtime, *jsSetter)
+    );
+  }
+  return descriptor;
+}
+
 void JSPropertiesDecorator::decorate(
   jsi::Runtime &runtime,
   jsi::Object &jsObject
 ) {
+  if (this->properties.empty()) {
+    return;
+  }
+
+  // Collect all descriptors first to define the properties with a single `Object.defineProperties` call.
+  jsi::Object descriptors(runtime);
+
   for (auto &[name, property]: this->properties) {
-    auto &[getter, setter] = property;
-
-    auto descriptor = JavaScriptObject::preparePropertyDescriptor(runtime,
-                                                                  1 << 1 /* enumerable */);
-    auto jsGetter = getter->toJSFunction(runtime);
-    if (jsGetter != nullptr) {
-      descriptor.setProperty(
-        runtime,
-        "get",
-        jsi::Value(runtime, *jsGetter)
-      );
-    }
-
-    auto jsSetter = setter->toJSFunction(runtime);
-    if (jsSetter != nullptr) {
-      descriptor.setProperty(
-        runtime,
-        "set",
-        jsi::Value(runtime, *jsSetter)
-      );
-    }
-    common::defineProperty(runtime, &jsObject, name.c_str(), std::move(descriptor));
+    descriptors.setProperty(
+      runtime,
+      jsi::PropNameID::forUtf8(runtime, name),
+      createDescriptor(runtime, property)
+    );
+  }
+
+  common::defineProperties(runtime, &jsObject, std::move(descriptors));
+}
+
+bool JSPropertiesDecorator::decorateMember(
+  jsi::Runtime &runtime,
+  jsi::Object &jsObject,
+  const std::string &name
+) {
+  auto property = this->properties.find(name);
+  if (property == this->properties.end()) {
+    return false;
+  }
+  common::defineProperty(runtime, &jsObject, name.c_str(), createDescriptor(runtime, property->second));
+  return true;
+}
+
+std::vector<std::string> JSPropertiesDecorator::getMemberNames() const {
+  std::vector<std::string> names;
+  names.reserve(this->properties.size());
+  for (const auto &[name, _]: this->properties) {
+    names.push_back(name);
   }
+  return names;
 }
 
 } // namespace expo
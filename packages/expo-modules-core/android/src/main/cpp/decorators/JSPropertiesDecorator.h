@@ -19,6 +19,7 @@ public:
     jni::alias_ref<jstring> name,
     jboolean getterTakesOwner,
     jni::alias_ref<jni::JArrayClass<ExpectedType>> getterExpectedArgsTypes,
+    jint getterCppReturnType,
     jni::alias_ref<JNIFunctionBody::javaobject> getter,
     jboolean setterTakesOwner,
     jni::alias_ref<jni::JArrayClass<ExpectedType>> setterExpectedArgsTypes,
@@ -30,12 +31,28 @@ public:
     jsi::Object &jsObject
   ) override;
 
+  bool supportsMemberDecoration() const override {
+    return true;
+  }
+
+  bool decorateMember(
+    jsi::Runtime &runtime,
+    jsi::Object &jsObject,
+    const std::string &name
+  ) override;
+
+  std::vector<std::string> getMemberNames() const override;
+
 private:
+  using Property = std::pair<std::shared_ptr<MethodMetadata>, std::shared_ptr<MethodMetadata>>;
+
+  static jsi::Object createDescriptor(jsi::Runtime &runtime, const Property &property);
+
   /**
   * A registry of properties
   * The first MethodMetadata points to the getter and the second one to the setter.
   */
-  std::unordered_map<std::string, std::pair<std::shared_ptr<MethodMetadata>, std::shared_ptr<MethodMetadata>>> properties;
+  std::unordered_map<std::string, Property> properties;
 };
 
 }
@@ -186,6 +186,12 @@ void MainRuntimeInstaller::installModules(
   const std::shared_ptr<jsi::Object> &hostObject
 ) noexcept {
   auto expoModules = std::make_shared<ExpoModulesHostObject>(jsiContext);
+  try {
+    // Modules are registered before the runtime is installed, so the table is complete.
+    expoModules->loadModules();
+  } catch (...) {
+    // The table is loaded again on first access, where the error can be reported to JS.
+  }
   auto expoModulesObject = jsi::Object::createFromHostObject(
     runtime,
     expoModules
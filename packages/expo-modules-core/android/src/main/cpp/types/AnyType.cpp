@@ -6,5 +6,6 @@
 namespace expo {
 AnyType::AnyType(
   jni::local_ref<expo::ExpectedType> expectedType
-) : converter(FrontendConverterProvider::instance()->obtainConverter(std::move(expectedType))) {}
+) : cppType(expectedType->getCombinedTypes()),
+    converter(FrontendConverterProvider::instance()->obtainConverter(std::move(expectedType))) {}
 } // namespace expo
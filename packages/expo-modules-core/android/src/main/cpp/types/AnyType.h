@@ -18,6 +18,11 @@ class AnyType {
 public:
   AnyType(jni::local_ref<ExpectedType> expectedType);
 
+  /*
+   * Combined types that the Kotlin side expects.
+   */
+  CppType cppType;
+
   /*
    * An instance of convert that should be used to convert from the jsi to the expected JNI type.
    */
@@ -0,0 +1,166 @@
+// Copyright © 2026-present 650 Industries, Inc. (aka Expo)
+
+#include "ArgumentsConverter.h"
+
+#include <typeinfo>
+
+namespace expo {
+
+namespace {
+
+template<typename Converter>
+jobject convertArgument(
+  jsi::Runtime &rt,
+  JNIEnv *env,
+  const jsi::Value &value,
+  [[maybe_unused]] const std::optional<TypedArrayKind> &typedArrayKind,
+  const FrontendConverter *converter
+) {
+  // The qualified call isn't dispatched through the vtable.
+  return static_cast<const Converter *>(converter)->Converter::convert(rt, env, value);
+}
+
+template<typename Converter>
+jobject convertNullableArgument(
+  jsi::Runtime &rt,
+  JNIEnv *env,
+  const jsi::Value &value,
+  [[maybe_unused]] const std::optional<TypedArrayKind> &typedArrayKind,
+  const FrontendConverter *parameterConverter
+) {
+  if (value.isNull() || value.isUndefined()) {
+    return nullptr;
+  }
+  return static_cast<const Converter *>(parameterConverter)->Converter::convert(rt, env, value);
+}
+
+jobject convertArgumentDynamically(
+  jsi::Runtime &rt,
+  JNIEnv *env,
+  const jsi::Value &value,
+  [[maybe_unused]] const std::optional<TypedArrayKind> &typedArrayKind,
+  const FrontendConverter *converter
+) {
+  return converter->convert(rt, env, value);
+}
+
+template<typename Converter>
+jobject convertClassifiedArgument(
+  jsi::Runtime &rt,
+  JNIEnv *env,
+  const jsi::Value &value,
+  const std::optional<TypedArrayKind> &typedArrayKind,
+  const FrontendConverter *converter
+) {
+  return static_cast<const Converter *>(converter)->convert(rt, env, value, typedArrayKind);
+}
+
+template<typename Converter>
+jobject convertNullableClassifiedArgument(
+  jsi::Runtime &rt,
+  JNIEnv *env,
+  const jsi::Value &value,
+  const std::optional<TypedArrayKind> &typedArrayKind,
+  const FrontendConverter *parameterConverter
+) {
+  if (value.isNull() || value.isUndefined()) {
+    return nullptr;
+  }
+  return static_cast<const Converter *>(parameterConverter)->convert(rt, env, value, typedArrayKind);
+}
+
+template<typename Converter>
+bool isConverterOf(const FrontendConverter *converter) {
+  // Subclasses may change the behavior, so only exact types are specialized.
+  return typeid(*converter) == typeid(Converter);
+}
+
+/**
+ * Returns the specialized routine for the given converter, if there is one.
+ */
+template<template<typename> class Routine>
+ArgumentsConverter::ConvertFunction getSpecializedFunction(const FrontendConverter *converter) {
+#define SPECIALIZE(type) \
+  if (isConverterOf<type>(converter)) { \
+    return Routine<type>::convert; \
+  }
+
+  SPECIALIZE(IntegerFrontendConverter)
+  SPECIALIZE(DoubleFrontendConverter)
+  SPECIALIZE(BooleanFrontendConverter)
+  SPECIALIZE(StringFrontendConverter)
+  SPECIALIZE(LongFrontendConverter)
+  SPECIALIZE(FloatFrontendConverter)
+  SPECIALIZE(JavaScriptObjectFrontendConverter)
+  SPECIALIZE(JavaScriptFunctionFrontendConverter)
+  SPECIALIZE(SharedObjectIdConverter)
+  SPECIALIZE(ViewTagFrontendConverter)
+#undef SPECIALIZE
+
+  return nullptr;
+}
+
+/**
+ * Returns the routine passing the classified typed array kind to the given converter, if it takes one.
+ */
+template<template<typename> class Routine>
+ArgumentsConverter::ConvertFunction getClassifiedFunction(const FrontendConverter *converter) {
+#define CLASSIFY(type) \
+  if (isConverterOf<type>(converter)) { \
+    return Routine<type>::convertClassified; \
+  }
+
+  CLASSIFY(ArrayBufferFrontendConverter)
+  CLASSIFY(NativeArrayBufferFrontendConverter)
+  CLASSIFY(JavaScriptArrayBufferFrontendConverter)
+#undef CLASSIFY
+
+  return nullptr;
+}
+
+template<typename Converter>
+struct Plain {
+  static constexpr auto convert = &convertArgument<Converter>;
+  static constexpr auto convertClassified = &convertClassifiedArgument<Converter>;
+};
+
+template<typename Converter>
+struct Nullable {
+  static constexpr auto convert = &convertNullableArgument<Converter>;
+  static constexpr auto convertClassified = &convertNullableClassifiedArgument<Converter>;
+};
+
+} // namespace
+
+ArgumentsConverter::ArgumentsConverter(
+  const std::vector<std::unique_ptr<AnyType>> &argTypes
+) {
+  steps.reserve(argTypes.size());
+  for (const auto &argType: argTypes) {
+    steps.push_back(createStep(argType->converter.get()));
+    hasTypedArraySteps |= steps.back().takesTypedArrayKind;
+  }
+}
+
+ArgumentsConverter::Step ArgumentsConverter::createStep(const FrontendConverter *converter) {
+  if (auto function = getSpecializedFunction<Plain>(converter)) {
+    return {function, converter, false};
+  }
+  if (auto function = getClassifiedFunction<Plain>(converter)) {
+    return {function, converter, true};
+  }
+
+  if (isConverterOf<NullableFrontendConverter>(converter)) {
+    auto parameterConverter = static_cast<const NullableFrontendConverter *>(converter)->getParameterConverter();
+    if (auto function = getSpecializedFunction<Nullable>(parameterConverter)) {
+      return {function, parameterConverter, false};
+    }
+    if (auto function = getClassifiedFunction<Nullable>(parameterConverter)) {
+      return {function, parameterConverter, true};
+    }
+  }
+
+  return {&convertArgumentDynamically, converter, false};
+}
+
+} // namespace expo
@@ -0,0 +1,76 @@
+// Copyright © 2026-present 650 Industries, Inc. (aka Expo)
+
+#pragma once
+
+#include "../ExpoHeader.pch"
+#include "AnyType.h"
+#include "FrontendConverter.h"
+
+namespace jni = facebook::jni;
+namespace jsi = facebook::jsi;
+
+namespace expo {
+
+/**
+ * Converts the arguments of a single function using routines selected when the function is registered.
+ * Arguments of the common types (numbers, booleans, strings and their nullable variants) are converted
+ * by template instantiations that call the concrete converter directly, so there are no virtual calls
+ * and no additional layers for the nullable types. Other arguments go through their `FrontendConverter`.
+ * Arguments converted to ArrayBuffers get the typed array kind classified for the whole argument list upfront,
+ * so the converters don't need to check it one by one.
+ */
+class ArgumentsConverter {
+public:
+  /**
+   * A conversion routine specialized for the argument type.
+   */
+  typedef jobject (*ConvertFunction)(
+    jsi::Runtime &rt,
+    JNIEnv *env,
+    const jsi::Value &value,
+    const std::optional<TypedArrayKind> &typedArrayKind,
+    const FrontendConverter *converter
+  );
+
+  ArgumentsConverter(const std::vector<std::unique_ptr<AnyType>> &argTypes);
+
+  /**
+   * Converts the argument at the given index. The typed array kind is only used by the arguments
+   * converted to ArrayBuffers, others can pass `std::nullopt`.
+   */
+  inline jobject convert(
+    size_t index,
+    jsi::Runtime &rt,
+    JNIEnv *env,
+    const jsi::Value &value,
+    const std::optional<TypedArrayKind> &typedArrayKind
+  ) const {
+    const Step &step = steps[index];
+    return step.function(rt, env, value, typedArrayKind, step.converter);
+  }
+
+  /**
+   * Whether any of the arguments uses its typed array kind, so the arguments need to be classified
+   * with `getTypedArrayKinds` before they're converted.
+   */
+  inline bool takesTypedArrays() const {
+    return hasTypedArraySteps;
+  }
+
+private:
+  struct Step {
+    ConvertFunction function;
+    /**
+     * The converter used by the function. It's owned by the corresponding `AnyType`.
+     */
+    const FrontendConverter *converter;
+    bool takesTypedArrayKind;
+  };
+
+  std::vector<Step> steps;
+  bool hasTypedArraySteps = false;
+
+  static Step createStep(const FrontendConverter *converter);
+};
+
+} // namespace expo
@@ -35,6 +35,8 @@ enum class CppType {
   NATIVE_ARRAY_BUFFER = 1 << 23,
   SERIALIZABLE = 1 << 24,
   ARRAY_BUFFER = 1 << 25,
+  RECORD = 1 << 26,
+  JAVA_MAP = 1 << 27,
 };
 
 } // namespace expo
@@ -16,6 +16,23 @@ jni::local_ref<ExpectedType::javaobject> SingleType::getSecondParameterType() {
   return method(self());
 }
 
+std::vector<std::string> SingleType::getFieldKeys() {
+  static const auto method = getClass()->getMethod<jni::local_ref<jni::JArrayClass<jstring>::javaobject>()>(
+    "getFieldKeys");
+  auto keys = method(self());
+  std::vector<std::string> result;
+  if (keys == nullptr) {
+    return result;
+  }
+
+  size_t size = keys->size();
+  result.reserve(size);
+  for (size_t i = 0; i < size; i++) {
+    result.push_back(keys->getElement(i)->toStdString());
+  }
+  return result;
+}
+
 CppType SingleType::getCppType() {
   static const auto method = getClass()->getMethod<int()>("getCppType");
   return static_cast<CppType>(method(self()));
@@ -79,6 +96,12 @@ std::string ExpectedType::getJClassString(bool allowsPrimitives) {
   if (type == CppType::READABLE_MAP) {
     return "com/facebook/react/bridge/ReadableNativeMap";
   }
+  if (type == CppType::JAVA_MAP) {
+    return "java/util/Map";
+  }
+  if (type == CppType::RECORD) {
+    return "[Ljava/lang/Object;";
+  }
   if (type == CppType::UINT8_TYPED_ARRAY) {
     return "[B";
   }
@@ -24,6 +24,11 @@ public:
   jni::local_ref<jni::JavaClass<ExpectedType>::javaobject> getFirstParameterType();
 
   jni::local_ref<jni::JavaClass<ExpectedType>::javaobject> getSecondParameterType();
+
+  /**
+   * Returns keys of the record fields in the order in which Kotlin expects their values.
+   */
+  std::vector<std::string> getFieldKeys();
 };
 
 /**
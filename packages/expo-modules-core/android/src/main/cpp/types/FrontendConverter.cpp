@@ -15,18 +15,38 @@
 #include "../JavaScriptValue.h"
 #include "../JavaScriptFunction.h"
 #include "../javaclasses/Collections.h"
+#include "JSIUtils.h"
 
 #include "react/jni/ReadableNativeMap.h"
 #include "react/jni/ReadableNativeArray.h"
 
 #include <utility>
 #include <algorithm>
+#include <atomic>
 
 namespace jni = facebook::jni;
 namespace jsi = facebook::jsi;
 namespace react = facebook::react;
 
 namespace expo {
+namespace {
+
+/**
+ * Checks whether the object is an ArrayBuffer view. Typed arrays of a known kind don't need to be checked again.
+ */
+bool isArrayBufferView(
+  jsi::Runtime &rt,
+  const jsi::Object &object,
+  const std::optional<TypedArrayKind> &typedArrayKind
+) {
+  if (typedArrayKind) {
+    return true;
+  }
+  return !object.isArrayBuffer(rt) && isTypedArray(rt, object);
+}
+
+} // namespace
+
 jobject IntegerFrontendConverter::convert(
   jsi::Runtime &rt,
   JNIEnv *env,
@@ -112,12 +132,20 @@ bool DoubleFrontendConverter::canConvert(jsi::Runtime &rt, const jsi::Value &val
   return value.isNumber();
 }
 
+StringFrontendConverter::StringFrontendConverter(
+  bool internsStrings
+) : internsStrings(internsStrings) {}
+
 jobject StringFrontendConverter::convert(
   jsi::Runtime &rt,
   JNIEnv *env,
   const jsi::Value &value
 ) const {
-  return env->NewStringUTF(value.asString(rt).utf8(rt).c_str());
+  auto string = value.asString(rt).utf16(rt);
+  if (internsStrings) {
+    return JCacheHolder::get().jStringInternCache.obtain(env, string);
+  }
+  return newJString(env, string);
 }
 
 bool StringFrontendConverter::canConvert(jsi::Runtime &rt, const jsi::Value &value) const {
@@ -160,10 +188,10 @@ jobject ByteArrayFrontendConverter::convert(
   JNIEnv *env,
   const jsi::Value &value
 ) const {
-  auto typedArray = TypedArray(rt, value.asObject(rt));
-  size_t length = typedArray.byteLength(rt);
+  auto view = TypedArray(rt, value.asObject(rt)).getView(rt);
+  size_t length = view.byteLength();
   auto byteArray = jni::JArrayByte::newArray(length);
-  byteArray->setRegion(0, length, static_cast<const signed char *>(typedArray.getRawPointer(rt)));
+  byteArray->setRegion(0, length, reinterpret_cast<const signed char *>(view.data()));
   return byteArray.release();
 }
 
@@ -172,11 +200,7 @@ bool ByteArrayFrontendConverter::canConvert(
   const jsi::Value &value
 ) const {
   if (value.isObject()) {
-    auto object = value.getObject(rt);
-    if (isTypedArray(rt, object)) {
-      auto typedArray = TypedArray(rt, object);
-      return typedArray.getKind(rt) == TypedArrayKind::Uint8Array;
-    }
+    return getTypedArrayKind(rt, value.getObject(rt)) == TypedArrayKind::Uint8Array;
   }
   return false;
 }
@@ -205,11 +229,20 @@ jobject ArrayBufferFrontendConverter::convert(
   jsi::Runtime &rt,
   JNIEnv *env,
   const jsi::Value &value
+) const {
+  return convert(rt, env, value, std::nullopt);
+}
+
+jobject ArrayBufferFrontendConverter::convert(
+  jsi::Runtime &rt,
+  JNIEnv *env,
+  const jsi::Value &value,
+  const std::optional<TypedArrayKind> &typedArrayKind
 ) const {
   JSIContext *jsiContext = getJSIContext(rt);
   auto object = value.asObject(rt);
 
-  if (isTypedArray(rt, object)) {
+  if (isArrayBufferView(rt, object, typedArrayKind)) {
     auto typedArray = TypedArray(rt, object);
     return ArrayBuffer::newInstance(jsiContext, rt, typedArray).release();
   }
@@ -237,11 +270,20 @@ jobject NativeArrayBufferFrontendConverter::convert(
   jsi::Runtime &rt,
   JNIEnv *env,
   const jsi::Value &value
+) const {
+  return convert(rt, env, value, std::nullopt);
+}
+
+jobject NativeArrayBufferFrontendConverter::convert(
+  jsi::Runtime &rt,
+  JNIEnv *env,
+  const jsi::Value &value,
+  const std::optional<TypedArrayKind> &typedArrayKind
 ) const {
   JSIContext *jsiContext = getJSIContext(rt);
   auto object = value.asObject(rt);
 
-  if (isTypedArray(rt, object)) {
+  if (isArrayBufferView(rt, object, typedArrayKind)) {
     auto typedArray = TypedArray(rt, object);
     return NativeArrayBuffer::newInstance(jsiContext, rt, typedArray).release();
   }
@@ -307,16 +349,34 @@ jobject JavaScriptArrayBufferFrontendConverter::convert(
   jsi::Runtime &rt,
   JNIEnv *env,
   const jsi::Value &value
+) const {
+  return convert(rt, env, value, std::nullopt);
+}
+
+jobject JavaScriptArrayBufferFrontendConverter::convert(
+  jsi::Runtime &rt,
+  JNIEnv *env,
+  const jsi::Value &value,
+  const std::optional<TypedArrayKind> &typedArrayKind
 ) const {
   JSIContext *jsiContext = getJSIContext(rt);
   auto object = value.asObject(rt);
-  auto arrayBuffer = isTypedArray(rt, object) ?
-    TypedArray(rt, object).getViewedBufferSlice(rt) :
-    object.getArrayBuffer(rt);
+  if (isArrayBufferView(rt, object, typedArrayKind)) {
+    // Share the typed array's backing buffer and expose only the viewed range,
+    // instead of copying the bytes with `getViewedBufferSlice`.
+    TypedArray typedArray(rt, object);
+    return JavaScriptArrayBuffer::newInstance(
+      jsiContext,
+      jsiContext->runtimeHolder->weak_from_this(),
+      std::make_shared<jsi::ArrayBuffer>(typedArray.getBuffer(rt)),
+      typedArray.byteOffset(rt),
+      typedArray.byteLength(rt)
+    ).release();
+  }
   return JavaScriptArrayBuffer::newInstance(
     jsiContext,
     jsiContext->runtimeHolder->weak_from_this(),
-    std::make_shared<jsi::ArrayBuffer>(std::move(arrayBuffer))
+    std::make_shared<jsi::ArrayBuffer>(object.getArrayBuffer(rt))
   ).release();
 }
 
@@ -608,7 +668,7 @@ jobject MapFrontendConverter::convert(
     auto key = propertyNames.getValueAtIndex(rt, i).getString(rt);
     auto jsValue = jsObject.getProperty(rt, key);
 
-    auto convertedKey = env->NewStringUTF(key.utf8(rt).c_str());
+    auto convertedKey = newJString(env, key.utf16(rt));
 
     auto convertedValue = valueConverter->convert(
       rt, env, jsValue
@@ -673,6 +733,10 @@ jobject AnyFrontendConvert::convert(
   JNIEnv *env,
   const jsi::Value &value
 ) const {
+  if (value.isNull() || value.isUndefined()) {
+    return nullptr;
+  }
+
   if (booleanConverter.canConvert(rt, value)) {
     return booleanConverter.convert(rt, env, value);
   }
@@ -714,7 +778,7 @@ jobject AnyFrontendConvert::convert(
     auto key = propertyNames.getValueAtIndex(rt, i).getString(rt);
     auto jsValue = obj.getProperty(rt, key);
 
-    auto convertedKey = env->NewStringUTF(key.utf8(rt).c_str());
+    auto convertedKey = newJString(env, key.utf16(rt));
     auto convertedValue = this->convert(
       rt, env, jsValue
     );
@@ -732,6 +796,84 @@ bool AnyFrontendConvert::canConvert(jsi::Runtime &rt, const jsi::Value &value) c
   return true;
 }
 
+jobject JavaMapFrontendConverter::convert(
+  jsi::Runtime &rt,
+  JNIEnv *env,
+  const jsi::Value &value
+) const {
+  return anyConverter.convert(rt, env, value);
+}
+
+bool JavaMapFrontendConverter::canConvert(jsi::Runtime &rt, const jsi::Value &value) const {
+  return value.isObject() && !value.getObject(rt).isArray(rt);
+}
+
+namespace {
+
+/**
+ * Prop names of the record fields, cached per runtime because they can't outlive it.
+ */
+struct RecordShapesCache {
+  static constexpr jsi::UUID uuid{0x6c34b392, 0xe705, 0x46eb, 0x9a73, 0xd549c7d48671};
+
+  RecordShapesCache(jsi::Runtime &runtime) {}
+
+  std::unordered_map<uint64_t, std::vector<jsi::PropNameID>> shapes;
+};
+
+std::atomic<uint64_t> nextRecordShapeId{1};
+
+} // namespace
+
+RecordFrontendConverter::RecordFrontendConverter(
+  jni::local_ref<SingleType::javaobject> expectedType
+) : fieldKeys(expectedType->getFieldKeys()),
+    shapeId(nextRecordShapeId.fetch_add(1, std::memory_order_relaxed)) {}
+
+const std::vector<jsi::PropNameID> &RecordFrontendConverter::getPropNames(jsi::Runtime &rt) const {
+  auto &shapes = common::getRuntimeCache<RecordShapesCache>(rt).shapes;
+  auto it = shapes.find(shapeId);
+  if (it != shapes.end()) {
+    return it->second;
+  }
+
+  std::vector<jsi::PropNameID> propNames;
+  propNames.reserve(fieldKeys.size());
+  for (const auto &key: fieldKeys) {
+    propNames.push_back(jsi::PropNameID::forUtf8(rt, key));
+  }
+  return shapes.emplace(shapeId, std::move(propNames)).first->second;
+}
+
+jobject RecordFrontendConverter::convert(
+  jsi::Runtime &rt,
+  JNIEnv *env,
+  const jsi::Value &value
+) const {
+  auto jsObject = value.asObject(rt);
+  const auto &propNames = getPropNames(rt);
+  auto &cache = JCacheHolder::get();
+
+  size_t size = propNames.size();
+  auto result = env->NewObjectArray(size, cache.jObject, nullptr);
+  for (size_t i = 0; i < size; i++) {
+    auto jsValue = jsObject.getProperty(rt, propNames[i]);
+    if (jsValue.isUndefined()) {
+      env->SetObjectArrayElement(result, i, cache.jUndefined);
+      continue;
+    }
+
+    auto convertedValue = valueConverter.convert(rt, env, jsValue);
+    env->SetObjectArrayElement(result, i, convertedValue);
+    env->DeleteLocalRef(convertedValue);
+  }
+  return result;
+}
+
+bool RecordFrontendConverter::canConvert(jsi::Runtime &rt, const jsi::Value &value) const {
+  return value.isObject();
+}
+
 NullableFrontendConverter::NullableFrontendConverter(
   jni::local_ref<SingleType::javaobject> expectedType
 ) : parameterConverter(
@@ -760,6 +902,10 @@ jobject NullableFrontendConverter::convert(
   return parameterConverter->convert(rt, env, value);
 }
 
+const FrontendConverter *NullableFrontendConverter::getParameterConverter() const {
+  return parameterConverter.get();
+}
+
 ValueOrUndefinedFrontendConverter::ValueOrUndefinedFrontendConverter(
   jni::local_ref<SingleType::javaobject> expectedType
 ) : parameterConverter(
@@ -4,6 +4,9 @@
 
 #include "../ExpoHeader.pch"
 #include "CppType.h"
+#include "TypedArray.h"
+
+#include <optional>
 
 namespace jni = facebook::jni;
 namespace jsi = facebook::jsi;
@@ -109,9 +112,16 @@ public:
 
 /**
  * Converter from js string to [java.lang.String].
+ * The string is passed as UTF-16 code units, so it's not transcoded on the way.
  */
 class StringFrontendConverter : public FrontendConverter {
 public:
+  /**
+   * @param internsStrings whether short strings should be obtained from the `JStringInternCache`.
+   * It's meant for values that are repeated a lot, like enum cases.
+   */
+  explicit StringFrontendConverter(bool internsStrings = false);
+
   jobject convert(
     jsi::Runtime &rt,
     JNIEnv *env,
@@ -119,6 +129,9 @@ public:
   ) const override;
 
   bool canConvert(jsi::Runtime &rt, const jsi::Value &value) const override;
+
+private:
+  const bool internsStrings;
 };
 
 /**
@@ -185,6 +198,17 @@ public:
     const jsi::Value &value
   ) const override;
 
+  /**
+   * Converts the value using its typed array kind classified upfront, e.g. by `getTypedArrayKinds`.
+   * When the kind is unknown, the value is checked for being an ArrayBuffer view as usual.
+   */
+  jobject convert(
+    jsi::Runtime &rt,
+    JNIEnv *env,
+    const jsi::Value &value,
+    const std::optional<TypedArrayKind> &typedArrayKind
+  ) const;
+
   bool canConvert(jsi::Runtime &rt, const jsi::Value &value) const override;
 };
 
@@ -196,6 +220,17 @@ public:
     const jsi::Value &value
   ) const override;
 
+  /**
+   * Converts the value using its typed array kind classified upfront, e.g. by `getTypedArrayKinds`.
+   * When the kind is unknown, the value is checked for being an ArrayBuffer view as usual.
+   */
+  jobject convert(
+    jsi::Runtime &rt,
+    JNIEnv *env,
+    const jsi::Value &value,
+    const std::optional<TypedArrayKind> &typedArrayKind
+  ) const;
+
   bool canConvert(jsi::Runtime &rt, const jsi::Value &value) const override;
 };
 
@@ -252,6 +287,17 @@ public:
     const jsi::Value &value
   ) const override;
 
+  /**
+   * Converts the value using its typed array kind classified upfront, e.g. by `getTypedArrayKinds`.
+   * When the kind is unknown, the value is checked for being an ArrayBuffer view as usual.
+   */
+  jobject convert(
+    jsi::Runtime &rt,
+    JNIEnv *env,
+    const jsi::Value &value,
+    const std::optional<TypedArrayKind> &typedArrayKind
+  ) const;
+
   bool canConvert(jsi::Runtime &rt, const jsi::Value &value) const override;
 };
 
@@ -456,6 +502,58 @@ private:
   StringFrontendConverter stringConverter;
 };
 
+/**
+ * Converter from js object to [java.util.LinkedHashMap] with values converted the same way as in [AnyFrontendConvert].
+ * Unlike [ReadableNativeMapArrayFrontendConverter], it walks the object once and creates Java objects directly,
+ * without materializing the whole object as folly::dynamic and then as a `ReadableNativeMap` first.
+ */
+class JavaMapFrontendConverter : public FrontendConverter {
+public:
+  jobject convert(
+    jsi::Runtime &rt,
+    JNIEnv *env,
+    const jsi::Value &value
+  ) const override;
+
+  bool canConvert(jsi::Runtime &rt, const jsi::Value &value) const override;
+
+private:
+  AnyFrontendConvert anyConverter;
+};
+
+/**
+ * Converter from js object to an array of values of the Kotlin record fields, ordered as the record expects them.
+ * Field names are resolved to `jsi::PropNameID`s once per runtime, so neither side looks up fields by string.
+ * Missing and undefined fields are represented as [expo.modules.kotlin.types.ValueOrUndefined.Undefined].
+ */
+class RecordFrontendConverter : public FrontendConverter {
+public:
+  RecordFrontendConverter(
+    jni::local_ref<jni::JavaClass<SingleType>::javaobject> expectedType
+  );
+
+  jobject convert(
+    jsi::Runtime &rt,
+    JNIEnv *env,
+    const jsi::Value &value
+  ) const override;
+
+  bool canConvert(jsi::Runtime &rt, const jsi::Value &value) const override;
+
+private:
+  std::vector<std::string> fieldKeys;
+
+  /**
+   * Identifies the record shape in the runtime cache of prop names.
+   * Unlike the converter address, it's never reused.
+   */
+  const uint64_t shapeId;
+
+  AnyFrontendConvert valueConverter;
+
+  const std::vector<jsi::PropNameID> &getPropNames(jsi::Runtime &rt) const;
+};
+
 class NullableFrontendConverter : public FrontendConverter {
 public:
   NullableFrontendConverter(
@@ -469,6 +567,8 @@ public:
   ) const override;
 
   bool canConvert(jsi::Runtime &rt, const jsi::Value &value) const override;
+
+  const FrontendConverter *getParameterConverter() const;
 private:
   std::shared_ptr<FrontendConverter> parameterConverter;
 };
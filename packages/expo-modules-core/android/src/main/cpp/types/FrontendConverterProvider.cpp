@@ -27,26 +27,30 @@ void FrontendConverterProvider::createConverters() {
   RegisterConverter(CppType::STRING, StringFrontendConverter);
   RegisterConverter(CppType::READABLE_MAP, ReadableNativeMapArrayFrontendConverter);
   RegisterConverter(CppType::READABLE_ARRAY, ReadableNativeArrayFrontendConverter);
+  RegisterConverter(CppType::JAVA_MAP, JavaMapFrontendConverter);
   RegisterConverter(CppType::VIEW_TAG, ViewTagFrontendConverter);
   RegisterConverter(CppType::SHARED_OBJECT_ID, SharedObjectIdConverter);
   RegisterConverter(CppType::ANY, AnyFrontendConvert);
 
 #undef RegisterConverter
 
-  auto registerPolyConverter = [this](const std::vector<CppType> &types) {
+  auto registerPolyConverter = [this](const std::vector<std::pair<CppType, std::shared_ptr<FrontendConverter>>> &types) {
     std::vector<std::shared_ptr<FrontendConverter>> converters;
     CppType finalType = CppType::NONE;
 
-    for (const auto type: types) {
+    for (const auto &[type, converter]: types) {
       finalType = (CppType) ((int) finalType | (int) type);
-      converters.push_back(simpleConverters.at(type));
+      converters.push_back(converter != nullptr ? converter : simpleConverters.at(type));
     }
 
     simpleConverters.insert({finalType, std::make_shared<PolyFrontendConverter>(converters)});
   };
 
-  // Enums
-  registerPolyConverter({CppType::STRING, CppType::INT});
+  // Enums - their string values are repeated a lot, so they're interned.
+  registerPolyConverter({
+    {CppType::STRING, std::make_shared<StringFrontendConverter>(true)},
+    {CppType::INT, nullptr}
+  });
 }
 
 void FrontendConverterProvider::registerConverter(
@@ -89,6 +93,10 @@ std::shared_ptr<FrontendConverter> FrontendConverterProvider::obtainConverter(
     return std::make_shared<ValueOrUndefinedFrontendConverter>(expectedType->getFirstType());
   }
 
+  if (combinedType == CppType::RECORD) {
+    return std::make_shared<RecordFrontendConverter>(expectedType->getFirstType());
+  }
+
   std::vector<std::shared_ptr<FrontendConverter>> converters;
   auto singleTypes = expectedType->getPossibleTypes();
   size_t size = singleTypes->size();
@@ -130,6 +138,10 @@ std::shared_ptr<FrontendConverter> FrontendConverterProvider::obtainConverterFor
     return std::make_shared<MapFrontendConverter>(expectedType);
   }
 
+  if (combinedType == CppType::RECORD) {
+    return std::make_shared<RecordFrontendConverter>(expectedType);
+  }
+
   // We don't have a converter for the expected type. That's why we used an UnknownFrontendConverter.
   return simpleConverters.at(CppType::NONE);
 }
@@ -2,6 +2,10 @@
 
 #include "JNIToJSIConverter.h"
 #include "../JavaReferencesCache.h"
+#include "MemoryBuffer.h"
+
+#include <algorithm>
+#include <string_view>
 
 namespace react = facebook::react;
 
@@ -14,13 +18,14 @@ constexpr char DYNAMIC_EXTENSION_PREFIX[] = "__expo_dynamic_extension__#";
  * Create an JavaScript Uint8Array instance from Java ByteArray.
  */
 jsi::Value createUint8Array(jsi::Runtime &rt, jni::alias_ref<jni::JArrayByte> byteArray) {
-  auto arrayBufferCtor = rt.global().getPropertyAsFunction(rt, "ArrayBuffer");
-  auto arrayBufferObject = arrayBufferCtor.callAsConstructor(rt, static_cast<int>(byteArray->size())).getObject(rt);
-  auto arrayBuffer = arrayBufferObject.getArrayBuffer(rt);
-  byteArray->getRegion(0, byteArray->size(), reinterpret_cast<signed char *>(arrayBuffer.data(rt)));
+  auto size = byteArray->size();
+  // The memory comes from the shared pool and goes back to it when the ArrayBuffer is collected.
+  auto buffer = MemoryBuffer::allocate(size);
+  byteArray->getRegion(0, size, reinterpret_cast<signed char *>(buffer->data()));
+  auto arrayBuffer = rt.createArrayBuffer(std::move(buffer));
 
   auto uint8ArrayCtor = rt.global().getPropertyAsFunction(rt, "Uint8Array");
-  auto uint8Array = uint8ArrayCtor.callAsConstructor(rt, arrayBufferObject).getObject(rt);
+  auto uint8Array = uint8ArrayCtor.callAsConstructor(rt, arrayBuffer).getObject(rt);
   return uint8Array;
 }
 
@@ -41,6 +46,54 @@ std::optional<jsi::Value> convertStringToFollyDynamicIfNeeded(jsi::Runtime &rt,
   return std::nullopt;
 }
 
+std::optional<jsi::Value> convertStringToFollyDynamicIfNeeded(jsi::Runtime &rt, const std::u16string& string) {
+  constexpr std::string_view prefix = DYNAMIC_EXTENSION_PREFIX;
+  if (string.size() < prefix.size() || !std::equal(prefix.begin(), prefix.end(), string.begin())) {
+    return std::nullopt;
+  }
+  // It's a rare case, so the runtime can do the transcoding.
+  auto utf8 = jsi::String::createFromUtf16(rt, string.data(), string.size()).utf8(rt);
+  return convertStringToFollyDynamicIfNeeded(rt, utf8);
+}
+
+ReturnType resolveReturnType(JNIEnv *env, jobject value) {
+  auto &cache = JCacheHolder::get();
+
+#define RETURN_IF_INSTANCE_OF(returnType, clazz) \
+  if (env->IsInstanceOf(value, clazz)) { \
+    return returnType; \
+  }
+
+  RETURN_IF_INSTANCE_OF(ReturnType::DOUBLE, cache.jDouble.clazz)
+  RETURN_IF_INSTANCE_OF(ReturnType::INT, cache.jInteger.clazz)
+  RETURN_IF_INSTANCE_OF(ReturnType::LONG, cache.jLong.clazz)
+  RETURN_IF_INSTANCE_OF(ReturnType::STRING, cache.jString)
+  RETURN_IF_INSTANCE_OF(ReturnType::BOOLEAN, cache.jBoolean.clazz)
+  RETURN_IF_INSTANCE_OF(ReturnType::FLOAT, cache.jFloat.clazz)
+  RETURN_IF_INSTANCE_OF(ReturnType::WRITEABLE_ARRAY, cache.jWritableNativeArray)
+  RETURN_IF_INSTANCE_OF(ReturnType::WRITEABLE_MAP, cache.jWritableNativeMap)
+  RETURN_IF_INSTANCE_OF(ReturnType::JS_MODULE, cache.jJavaScriptModuleObject)
+  RETURN_IF_INSTANCE_OF(ReturnType::SHARED_OBJECT, cache.jSharedObject)
+  RETURN_IF_INSTANCE_OF(ReturnType::JS_TYPED_ARRAY, cache.jJavaScriptTypedArray)
+  RETURN_IF_INSTANCE_OF(ReturnType::JS_ARRAY_BUFFER, cache.jJavaScriptArrayBuffer)
+  RETURN_IF_INSTANCE_OF(ReturnType::ARRAY_BUFFER, cache.jArrayBuffer)
+  RETURN_IF_INSTANCE_OF(ReturnType::NATIVE_ARRAY_BUFFER, cache.jNativeArrayBuffer)
+
+  RETURN_IF_INSTANCE_OF(ReturnType::MAP, cache.jMap)
+  RETURN_IF_INSTANCE_OF(ReturnType::COLLECTION, cache.jCollection)
+
+  // Primitives arrays
+  RETURN_IF_INSTANCE_OF(ReturnType::DOUBLE_ARRAY, cache.jDoubleArray)
+  RETURN_IF_INSTANCE_OF(ReturnType::BOOLEAN_ARRAY, cache.jBooleanArray)
+  RETURN_IF_INSTANCE_OF(ReturnType::INT_ARRAY, cache.jIntegerArray)
+  RETURN_IF_INSTANCE_OF(ReturnType::LONG_ARRAY, cache.jLongArray)
+  RETURN_IF_INSTANCE_OF(ReturnType::FLOAT_ARRAY, cache.jFloatArray)
+
+#undef RETURN_IF_INSTANCE_OF
+
+  return ReturnType::UNKNOWN;
+}
+
 jsi::Value convert(
   JNIEnv *env,
   jsi::Runtime &rt,
@@ -49,46 +102,13 @@ jsi::Value convert(
   if (value == nullptr) {
     return jsi::Value::null();
   }
-  auto unpackedValue = value.get();
-  auto &cache = JCacheHolder::get();
 
-  // We could use jni::static_ref_cast here. It will lead to the creation of a new local reference.
-  // Which is actually slow. We can use some pointer magic to avoid it.
-#define CAST_AND_RETURN(type, clazz) \
-  if (env->IsInstanceOf(unpackedValue, clazz)) { \
-    return convertToJS(env, rt, *((jni::local_ref<type>*)((void*)&value))); \
+  // The instance checks depend only on the class of the value, so they're done once per class.
+  auto returnType = JCacheHolder::get().jClassReturnTypeCache.get(env, value.get(), &resolveReturnType);
+  if (returnType == ReturnType::UNKNOWN) {
+    return jsi::Value::undefined();
   }
-#define COMMA ,
-
-  CAST_AND_RETURN(jni::JDouble, cache.jDouble.clazz)
-  CAST_AND_RETURN(jni::JInteger, cache.jInteger.clazz)
-  CAST_AND_RETURN(jni::JLong, cache.jLong.clazz)
-  CAST_AND_RETURN(jni::JString, cache.jString)
-  CAST_AND_RETURN(jni::JBoolean, cache.jBoolean.clazz)
-  CAST_AND_RETURN(jni::JFloat, cache.jFloat.clazz)
-  CAST_AND_RETURN(react::WritableNativeArray::javaobject, cache.jWritableNativeArray)
-  CAST_AND_RETURN(react::WritableNativeMap::javaobject, cache.jWritableNativeMap)
-  CAST_AND_RETURN(JavaScriptModuleObject::javaobject, cache.jJavaScriptModuleObject)
-  CAST_AND_RETURN(JSharedObject::javaobject, cache.jSharedObject)
-  CAST_AND_RETURN(JavaScriptTypedArray::javaobject, cache.jJavaScriptTypedArray)
-  CAST_AND_RETURN(JavaScriptArrayBuffer::javaobject, cache.jJavaScriptArrayBuffer)
-  CAST_AND_RETURN(ArrayBuffer::javaobject, cache.jArrayBuffer)
-  CAST_AND_RETURN(NativeArrayBuffer::javaobject, cache.jNativeArrayBuffer)
-
-  CAST_AND_RETURN(jni::JMap<jstring COMMA jobject>, cache.jMap)
-  CAST_AND_RETURN(jni::JCollection<jobject>, cache.jCollection)
-
-  // Primitives arrays
-  CAST_AND_RETURN(jni::JArrayDouble, cache.jDoubleArray)
-  CAST_AND_RETURN(jni::JArrayBoolean, cache.jBooleanArray)
-  CAST_AND_RETURN(jni::JArrayInt, cache.jIntegerArray)
-  CAST_AND_RETURN(jni::JArrayLong, cache.jLongArray)
-  CAST_AND_RETURN(jni::JArrayFloat, cache.jFloatArray)
-
-#undef COMMA
-#undef CAST_AND_RETURN
-
-  return jsi::Value::undefined();
+  return convert(env, rt, returnType, value);
 }
 
 jsi::Value convert(
@@ -101,6 +121,10 @@ jsi::Value convert(
     return convertToJS(env, rt, *((jni::local_ref<type>*)((void*)&value)));
 #define COMMA ,
 
+  if (value == nullptr) {
+    return jsi::Value::null();
+  }
+
   switch (returnType) {
     case ReturnType::UNKNOWN:
       return convert(env, rt, value);
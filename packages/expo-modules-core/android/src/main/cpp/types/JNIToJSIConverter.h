@@ -7,6 +7,7 @@
 #include "../JSIContext.h"
 #include "../JSharedObject.h"
 #include "../JNIUtils.h"
+#include "../JStrings.h"
 #include "ObjectDeallocator.h"
 #include "../JavaScriptArrayBuffer.h"
 #include "../NativeArrayBuffer.h"
@@ -23,12 +24,25 @@ namespace react = facebook::react;
 
 namespace expo {
 
+/**
+ * Returns the type that should be used to convert the given non-null value
+ * or `ReturnType::UNKNOWN` if the value can't be converted.
+ */
+ReturnType resolveReturnType(JNIEnv *env, jobject value);
+
+/**
+ * Converts the value of an unknown type. The type is resolved based on the class of the value.
+ */
 jsi::Value convert(
   JNIEnv *env,
   jsi::Runtime &rt,
   const jni::local_ref<jobject> &value
 );
 
+/**
+ * Converts the value of the declared type, which skips resolving the type.
+ * The value has to be an instance of the declared type or null.
+ */
 jsi::Value convert(
   JNIEnv *env,
   jsi::Runtime &rt,
@@ -41,6 +55,11 @@ std::optional<jsi::Value> convertStringToFollyDynamicIfNeeded(
   const std::string &string
 );
 
+std::optional<jsi::Value> convertStringToFollyDynamicIfNeeded(
+  jsi::Runtime &rt,
+  const std::u16string &string
+);
+
 std::optional<jsi::Value> decorateValueForDynamicExtension(
   jsi::Runtime &rt,
   const jsi::Value &value
@@ -62,10 +81,7 @@ inline auto unwrapJNIRef(
   if constexpr (HasCthis<T>) {
     return value->cthis();
   } else if constexpr (IsJString<T>) {
-    const char *rawValue = env->GetStringUTFChars(value.get(), nullptr);
-    std::string result = rawValue;
-    env->ReleaseStringUTFChars(value.get(), rawValue);
-    return result;
+    return readJString(env, value.get());
   } else if constexpr (IsJBoolean<T>) {
     return static_cast<bool>(value->value());
   } else if constexpr (HasValue<T>) {
@@ -221,6 +237,16 @@ struct JNIToJSIConverter<std::string> {
   }
 };
 
+template<>
+struct JNIToJSIConverter<std::u16string> {
+  static jsi::Value convert(JNIEnv *, jsi::Runtime &rt, const std::u16string &value) {
+    if (auto enhanced = convertStringToFollyDynamicIfNeeded(rt, value)) {
+      return std::move(*enhanced);
+    }
+    return jsi::String::createFromUtf16(rt, value.data(), value.size());
+  }
+};
+
 template<>
 struct JNIToJSIConverter<folly::dynamic> {
   static jsi::Value convert(JNIEnv *, jsi::Runtime &rt, const folly::dynamic &value) {
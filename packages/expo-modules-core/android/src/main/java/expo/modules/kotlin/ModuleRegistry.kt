@@ -21,6 +21,11 @@ class ModuleRegistry(
 
   private var isReadyForPostingEvents = false
 
+  /**
+   * Called after modules are registered or removed, e.g. to reload the module table of the installed runtime.
+   */
+  internal var onModulesChanged: (() -> Unit)? = null
+
   fun <T : Module> register(module: T, name: String?) = trace("ModuleRegistry.register(${module.javaClass})") {
     requireNotNull(appContextHolder.get()) { "Cannot register a module to an invalid app context." }
 
@@ -37,6 +42,7 @@ class ModuleRegistry(
     }
 
     registry[holder.name] = holder
+    onModulesChanged?.invoke()
   }
 
   fun register(provider: ModulesProvider) = apply {
@@ -126,6 +132,7 @@ class ModuleRegistry(
 
   fun cleanUp() {
     registry.clear()
+    onModulesChanged?.invoke()
     logger.info("✅ ModuleRegistry was destroyed")
   }
 
@@ -0,0 +1,25 @@
+package expo.modules.kotlin.events
+
+/**
+ * Describes how events emitted from native code are delivered to JavaScript listeners.
+ * Events are collected on the native side and delivered in a single JavaScript task,
+ * the policy decides what happens with events of the same name emitted to the same object before that task runs.
+ * Raw values have to be in sync with `EventEmitter::DeliveryPolicy::Mode` in C++.
+ */
+enum class EventDeliveryPolicy(val value: Int) {
+  /**
+   * Every event is delivered, in the order they were emitted.
+   */
+  ALL(0),
+
+  /**
+   * Only the latest event is delivered.
+   */
+  LATEST(1),
+
+  /**
+   * At most one event is delivered per sample interval. Events emitted sooner than that after the previous one
+   * are held back and only the last of them is delivered once the interval elapses.
+   */
+  SAMPLE(2)
+}
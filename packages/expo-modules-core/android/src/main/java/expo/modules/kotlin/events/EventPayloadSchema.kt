@@ -0,0 +1,180 @@
+package expo.modules.kotlin.events
+
+import expo.modules.kotlin.exception.Exceptions
+import expo.modules.kotlin.jni.JNIUtils
+import java.nio.ByteBuffer
+import java.nio.ByteOrder
+
+/**
+ * Describes the payload of an event as a fixed list of named fields of numeric types.
+ * Payloads of such events are sent to JavaScript as packed binary records and decoded into objects
+ * on the JavaScript thread, without going through maps. The schema should be created once, e.g. as a module property,
+ * and shared by all emitted payloads.
+ * Fields are laid out one after another, without padding, in the native byte order.
+ * Raw values of [FieldType] have to be in sync with `EventPayloadSchema::FieldType` in C++.
+ */
+class EventPayloadSchema private constructor(
+  internal val fieldNames: Array<String>,
+  internal val fieldTypes: Array<FieldType>
+) {
+  enum class FieldType(val value: Int, internal val size: Int) {
+    INT(0, Int.SIZE_BYTES),
+
+    /**
+     * Converted to a JavaScript number, so values above 2^53 lose precision.
+     */
+    LONG(1, Long.SIZE_BYTES),
+    FLOAT(2, Float.SIZE_BYTES),
+    DOUBLE(3, Double.SIZE_BYTES),
+    BOOLEAN(4, 1)
+  }
+
+  private val offsets = IntArray(fieldTypes.size)
+
+  private val indices = HashMap<String, Int>(fieldNames.size)
+
+  /**
+   * The size of a single payload in bytes.
+   */
+  val size: Int
+
+  init {
+    var offset = 0
+    fieldTypes.forEachIndexed { index, type ->
+      offsets[index] = offset
+      offset += type.size
+    }
+    size = offset
+    fieldNames.forEachIndexed { index, name ->
+      indices[name] = index
+    }
+  }
+
+  /**
+   * The ID of the schema on the native side. The schema is registered the first time it's used.
+   */
+  internal val id: Int by lazy {
+    JNIUtils.registerEventPayloadSchema(fieldNames, IntArray(fieldTypes.size) { fieldTypes[it].value })
+  }
+
+  /**
+   * Creates a new payload of this schema, with all fields set to zero.
+   */
+  fun newPayload(): EventPayload = EventPayload(this)
+
+  /**
+   * Returns the index of the field with the given name. Pass it to the index-based setters of [EventPayload]
+   * to avoid looking the field up by its name for every event.
+   */
+  fun fieldIndex(name: String): Int =
+    indices[name] ?: throw Exceptions.IllegalArgument("Event payload doesn't have the '$name' field")
+
+  internal fun offsetOf(name: String, type: FieldType): Int = offsetOf(fieldIndex(name), type)
+
+  internal fun offsetOf(index: Int, type: FieldType): Int {
+    if (index !in fieldTypes.indices) {
+      throw Exceptions.IllegalArgument("Event payload doesn't have a field at index $index")
+    }
+    if (fieldTypes[index] != type) {
+      throw Exceptions.IllegalArgument("Event payload field '${fieldNames[index]}' is of type ${fieldTypes[index]}, not $type")
+    }
+    return offsets[index]
+  }
+
+  class Builder {
+    private val fields = LinkedHashMap<String, FieldType>()
+
+    fun int(name: String) = field(name, FieldType.INT)
+    fun long(name: String) = field(name, FieldType.LONG)
+    fun float(name: String) = field(name, FieldType.FLOAT)
+    fun double(name: String) = field(name, FieldType.DOUBLE)
+    fun boolean(name: String) = field(name, FieldType.BOOLEAN)
+
+    fun field(name: String, type: FieldType) = apply {
+      if (fields.put(name, type) != null) {
+        throw Exceptions.IllegalArgument("Event payload field '$name' is declared more than once")
+      }
+    }
+
+    fun build() = EventPayloadSchema(fields.keys.toTypedArray(), fields.values.toTypedArray())
+  }
+}
+
+/**
+ * Creates an [EventPayloadSchema] with the fields declared in the [block].
+ */
+@Suppress("FunctionName")
+inline fun EventPayloadSchema(block: EventPayloadSchema.Builder.() -> Unit): EventPayloadSchema =
+  EventPayloadSchema.Builder().apply(block).build()
+
+/**
+ * A binary payload of an event described by the [schema].
+ * The payload is copied when the event is sent, so it can be reused for the next event right away.
+ * It isn't thread-safe.
+ */
+class EventPayload internal constructor(val schema: EventPayloadSchema) {
+  internal val buffer: ByteBuffer = ByteBuffer
+    .allocateDirect(schema.size)
+    .order(ByteOrder.nativeOrder())
+
+  fun putInt(name: String, value: Int) = apply {
+    buffer.putInt(schema.offsetOf(name, EventPayloadSchema.FieldType.INT), value)
+  }
+
+  fun putLong(name: String, value: Long) = apply {
+    buffer.putLong(schema.offsetOf(name, EventPayloadSchema.FieldType.LONG), value)
+  }
+
+  fun putFloat(name: String, value: Float) = apply {
+    buffer.putFloat(schema.offsetOf(name, EventPayloadSchema.FieldType.FLOAT), value)
+  }
+
+  fun putDouble(name: String, value: Double) = apply {
+    buffer.putDouble(schema.offsetOf(name, EventPayloadSchema.FieldType.DOUBLE), value)
+  }
+
+  fun putBoolean(name: String, value: Boolean) = apply {
+    buffer.put(schema.offsetOf(name, EventPayloadSchema.FieldType.BOOLEAN), if (value) 1 else 0)
+  }
+
+  // Setters taking the field index returned by [EventPayloadSchema.fieldIndex].
+
+  fun putInt(fieldIndex: Int, value: Int) = apply {
+    buffer.putInt(schema.offsetOf(fieldIndex, EventPayloadSchema.FieldType.INT), value)
+  }
+
+  fun putLong(fieldIndex: Int, value: Long) = apply {
+    buffer.putLong(schema.offsetOf(fieldIndex, EventPayloadSchema.FieldType.LONG), value)
+  }
+
+  fun putFloat(fieldIndex: Int, value: Float) = apply {
+    buffer.putFloat(schema.offsetOf(fieldIndex, EventPayloadSchema.FieldType.FLOAT), value)
+  }
+
+  fun putDouble(fieldIndex: Int, value: Double) = apply {
+    buffer.putDouble(schema.offsetOf(fieldIndex, EventPayloadSchema.FieldType.DOUBLE), value)
+  }
+
+  fun putBoolean(fieldIndex: Int, value: Boolean) = apply {
+    buffer.put(schema.offsetOf(fieldIndex, EventPayloadSchema.FieldType.BOOLEAN), if (value) 1 else 0)
+  }
+
+  /**
+   * Converts the payload to a map with the same fields, for emitters that can't send binary payloads.
+   */
+  internal fun toMap(): Map<String, Any?> {
+    val result = LinkedHashMap<String, Any?>(schema.fieldNames.size)
+    schema.fieldNames.forEachIndexed { index, name ->
+      val type = schema.fieldTypes[index]
+      val offset = schema.offsetOf(index, type)
+      result[name] = when (type) {
+        EventPayloadSchema.FieldType.INT -> buffer.getInt(offset)
+        EventPayloadSchema.FieldType.LONG -> buffer.getLong(offset)
+        EventPayloadSchema.FieldType.FLOAT -> buffer.getFloat(offset)
+        EventPayloadSchema.FieldType.DOUBLE -> buffer.getDouble(offset)
+        EventPayloadSchema.FieldType.BOOLEAN -> buffer.get(offset).toInt() != 0
+      }
+    }
+    return result
+  }
+}
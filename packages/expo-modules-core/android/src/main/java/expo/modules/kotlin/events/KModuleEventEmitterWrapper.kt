@@ -9,6 +9,8 @@ import com.facebook.react.modules.core.DeviceEventManagerModule.RCTDeviceEventEm
 import com.facebook.react.uimanager.UIManagerHelper
 import expo.modules.kotlin.ModuleHolder
 import expo.modules.kotlin.jni.JNIUtils
+import expo.modules.kotlin.jni.JSIContext
+import expo.modules.kotlin.jni.JavaScriptModuleObject
 import expo.modules.kotlin.records.Record
 import expo.modules.kotlin.types.JSTypeConverterProvider
 import expo.modules.kotlin.types.toJSValueExperimental
@@ -44,11 +46,24 @@ class KModuleEventEmitterWrapper(
     emitNative(eventName, eventBody?.toJSValueExperimental())
   }
 
+  fun emit(eventName: String, payload: EventPayload) {
+    checkIfEventWasExported(eventName)
+    emitNative { jsObject, jsiContext ->
+      JNIUtils.emitEvent(jsObject, jsiContext, JNIUtils.getEventId(eventName), payload.schema.id, payload.buffer)
+    }
+  }
+
   private fun emitNative(eventName: String, eventBody: Map<String, Any?>?) {
+    emitNative { jsObject, jsiContext ->
+      JNIUtils.emitEvent(jsObject, jsiContext, JNIUtils.getEventId(eventName), eventBody)
+    }
+  }
+
+  private inline fun emitNative(emit: (JavaScriptModuleObject, JSIContext) -> Unit) {
     val runtimeContext = moduleHolder.module.runtime
     val jsObject = moduleHolder.safeJSObject ?: return
     try {
-      JNIUtils.emitEvent(jsObject, runtimeContext.jsiContext, eventName, eventBody)
+      emit(jsObject, runtimeContext.jsiContext)
     } catch (e: Exception) {
       // If the jsObject is valid, we should throw an exception.
       // Otherwise, we should ignore it.
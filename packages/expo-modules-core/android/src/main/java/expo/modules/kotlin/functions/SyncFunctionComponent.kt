@@ -3,16 +3,20 @@ package expo.modules.kotlin.functions
 import expo.modules.kotlin.AppContext
 import expo.modules.kotlin.exception.FunctionCallException
 import expo.modules.kotlin.exception.exceptionDecorator
+import expo.modules.kotlin.jni.CppType
 import expo.modules.kotlin.jni.JNIFunctionBody
+import expo.modules.kotlin.jni.JNIPrimitiveFunctionBody
 import expo.modules.kotlin.jni.decorators.JSDecoratorsBridgingObject
 import expo.modules.kotlin.types.AnyType
 import expo.modules.kotlin.types.ConverterContext
 import expo.modules.kotlin.types.ReturnType
 
+private val primitiveCppTypes = arrayOf(CppType.DOUBLE, CppType.INT, CppType.LONG, CppType.FLOAT, CppType.BOOLEAN)
+
 class SyncFunctionComponent(
   name: String,
   argTypes: Array<AnyType>,
-  private val returnType: ReturnType,
+  internal val returnType: ReturnType,
   private val body: (args: Array<out Any?>) -> Any?
 ) : AnyFunction(name, argTypes) {
   fun callUserImplementation(args: Array<Any?>, converterContext: ConverterContext): Any? {
@@ -20,13 +24,86 @@ class SyncFunctionComponent(
   }
 
   internal fun getJNIFunctionBody(moduleName: String, converterContext: ConverterContext): JNIFunctionBody {
-    return JNIFunctionBody { args ->
-      return@JNIFunctionBody exceptionDecorator({
-        FunctionCallException(name, moduleName, it)
-      }) {
-        val result = callUserImplementation(args, converterContext)
-        return@exceptionDecorator returnType.convertToJS(result)
-      }
+    val body = createJNIFunctionBody(moduleName) { args ->
+      callUserImplementation(args, converterContext)
+    }
+
+    val primitiveArgTypes = getPrimitiveArgTypes() ?: return body
+    // Arguments received as primitives already have the expected types, so they skip the conversion
+    // unless some of their converters do more than that (e.g. create enums or durations from numbers).
+    if (desiredArgsTypes.any { !it.isTrivial() }) {
+      return PrimitiveFunctionBody(primitiveArgTypes, body, body)
+    }
+    val convertedArgsBody = createJNIFunctionBody(moduleName, this.body)
+    return PrimitiveFunctionBody(primitiveArgTypes, body, convertedArgsBody)
+  }
+
+  /**
+   * Wraps the call in the function's exception handling and converts its result to JS.
+   */
+  private inline fun createJNIFunctionBody(
+    moduleName: String,
+    crossinline call: (args: Array<Any?>) -> Any?
+  ) = JNIFunctionBody { args ->
+    return@JNIFunctionBody exceptionDecorator({
+      FunctionCallException(name, moduleName, it)
+    }) {
+      returnType.convertToJS(call(args))
+    }
+  }
+
+  /**
+   * Returns types of the arguments if all of them can be passed from cpp without boxing.
+   */
+  private fun getPrimitiveArgTypes(): Array<CppType>? {
+    if (takesOwner) {
+      return null
+    }
+    val cppTypes = getCppRequiredTypes()
+    if (cppTypes.size > JNIPrimitiveFunctionBody.MAX_ARGS_COUNT) {
+      return null
+    }
+    return Array(cppTypes.size) { index ->
+      val combinedTypes = cppTypes[index].getCombinedTypes()
+      primitiveCppTypes.firstOrNull { it.value == combinedTypes } ?: return null
+    }
+  }
+
+  /**
+   * Receives arguments from cpp as primitives and passes them to the user implementation without converting them.
+   * They still have to be boxed here, because the implementation is a generic function taking an array of arguments.
+   */
+  private class PrimitiveFunctionBody(
+    private val argTypes: Array<CppType>,
+    private val body: JNIFunctionBody,
+    private val convertedArgsBody: JNIFunctionBody
+  ) : JNIPrimitiveFunctionBody {
+    override fun invoke(args: Array<Any?>): Any? = body.invoke(args)
+
+    override fun invokeWithPrimitives(): Any? =
+      convertedArgsBody.invoke(emptyArray())
+
+    override fun invokeWithPrimitives(arg0: Double): Any? =
+      convertedArgsBody.invoke(arrayOf(box(0, arg0)))
+
+    override fun invokeWithPrimitives(arg0: Double, arg1: Double): Any? =
+      convertedArgsBody.invoke(arrayOf(box(0, arg0), box(1, arg1)))
+
+    override fun invokeWithPrimitives(arg0: Double, arg1: Double, arg2: Double): Any? =
+      convertedArgsBody.invoke(arrayOf(box(0, arg0), box(1, arg1), box(2, arg2)))
+
+    override fun invokeWithPrimitives(arg0: Double, arg1: Double, arg2: Double, arg3: Double): Any? =
+      convertedArgsBody.invoke(arrayOf(box(0, arg0), box(1, arg1), box(2, arg2), box(3, arg3)))
+
+    /**
+     * Converts the argument the same way as the cpp frontend converters do.
+     */
+    private fun box(index: Int, value: Double): Any = when (argTypes[index]) {
+      CppType.INT -> value.toInt()
+      CppType.LONG -> value.toLong()
+      CppType.FLOAT -> value.toFloat()
+      CppType.BOOLEAN -> value != 0.0
+      else -> value
     }
   }
 
@@ -79,6 +79,8 @@ class ArrayBuffer : Destructible {
 
   /**
    * Provides scoped access to this buffer's visible bytes.
+   * For JavaScript-backed storage, the whole [body] runs in a single hop to the JavaScript thread,
+   * so it's the preferred way to do many reads at once.
    *
    * The [ByteBuffer] passed to [body] is valid only for the duration of [body].
    * The body must not retain it, detach, transfer, or resize the JavaScript backing while it is live.
@@ -176,6 +178,46 @@ class ArrayBuffer : Destructible {
     )
   }
 
+  /**
+   * Copies `destination.remaining()` bytes starting at the byte offset [position] into [destination]
+   * and advances its position. JavaScript-backed storage is read in a single hop to the JavaScript thread,
+   * so prefer this (or [withJSBytes] for many reads in one scope) over chunked `read*` calls.
+   */
+  @Throws(Throwable::class)
+  fun copyTo(destination: ByteBuffer, position: Int = 0) {
+    validateCopyRange(destination, position)
+    withJSBytes { scopedBytes ->
+      scopedBytes.copyRangeTo(destination, position)
+    }
+  }
+
+  /**
+   * Copies `destination.remaining()` bytes starting at the byte offset [position] into [destination]
+   * and advances its position, without blocking the caller while JavaScript-backed storage hops to
+   * the JavaScript thread. The whole copy is done in a single JavaScript-thread task.
+   * If cancellation occurs before the task begins, [destination] is not modified.
+   */
+  @Throws(Throwable::class)
+  suspend fun copyToAsync(destination: ByteBuffer, position: Int = 0) {
+    validateCopyRange(destination, position)
+    withJSBytesAsync { scopedBytes ->
+      scopedBytes.copyRangeTo(destination, position)
+    }
+  }
+
+  private fun validateCopyRange(destination: ByteBuffer, position: Int) {
+    if (position < 0 || destination.remaining() > size() - position) {
+      throw Exceptions.IllegalArgument("ArrayBuffer copy range is out of bounds")
+    }
+  }
+
+  private fun ByteBuffer.copyRangeTo(destination: ByteBuffer, position: Int) {
+    val source = duplicate()
+    source.limit(position + destination.remaining())
+    source.position(position)
+    destination.put(source)
+  }
+
   private suspend fun <R> withScopedJSBytesAsync(
     schedule: (
       JNIFunctionBody,
@@ -224,6 +266,15 @@ class ArrayBuffer : Destructible {
    */
   fun copy(): ArrayBuffer = copyOf(this)
 
+  /**
+   * Releases the native part of this ArrayBuffer, so the buffer can no longer be used.
+   * For buffers created with [allocatePooled], the memory goes back to the pool once it's also
+   * released by JavaScript, instead of waiting for this object to be garbage collected.
+   */
+  fun recycle() {
+    mHybridData.resetNative()
+  }
+
   @Throws(Throwable::class)
   protected fun finalize() {
     mHybridData.resetNative()
@@ -233,6 +284,24 @@ class ArrayBuffer : Destructible {
     return mHybridData
   }
 
+  /**
+   * Statistics of the native memory pool.
+   */
+  data class PoolStats(
+    /**
+     * Number of allocations that reused the memory of a released buffer.
+     */
+    val hits: Long,
+    /**
+     * Number of allocations that needed new memory.
+     */
+    val misses: Long,
+    /**
+     * Total size of the memory currently kept in the pool for reuse.
+     */
+    val pooledBytes: Long
+  )
+
   companion object {
     /**
      * Allocate a new [ArrayBuffer] with the given [size].
@@ -242,6 +311,34 @@ class ArrayBuffer : Destructible {
       return ArrayBuffer(buffer)
     }
 
+    /**
+     * Allocate a new zero-filled [ArrayBuffer] with the given [size] using memory from a native pool.
+     * The memory is reused by next pooled buffers once this buffer is released, either by calling [recycle]
+     * or when it's garbage collected. Like typed-array views, [toDirectBuffer] returns a copy of the bytes;
+     * use [withJSBytes] or [withMutableJSBytes] to access them without copying.
+     */
+    fun allocatePooled(size: Int): ArrayBuffer {
+      if (size < 0) {
+        throw Exceptions.IllegalArgument("ArrayBuffer size cannot be negative")
+      }
+      return allocatePooledNative(size)
+    }
+
+    @JvmStatic
+    private external fun allocatePooledNative(size: Int): ArrayBuffer
+
+    /**
+     * Returns the statistics of the native memory pool used by [allocatePooled] and by buffers created
+     * natively for JavaScript, e.g. returned `ByteArray`s.
+     */
+    fun getPoolStats(): PoolStats {
+      val (hits, misses, pooledBytes) = getPoolStatsNative()
+      return PoolStats(hits, misses, pooledBytes)
+    }
+
+    @JvmStatic
+    private external fun getPoolStatsNative(): LongArray
+
     /**
      * Wrap the given [ByteBuffer] in a new **owning** `ArrayBuffer`.
      * The buffer must be direct, otherwise the function throws.
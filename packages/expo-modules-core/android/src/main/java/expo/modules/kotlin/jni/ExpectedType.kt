@@ -13,7 +13,11 @@ class SingleType(
   /**
    * Types of generic parameters.
    */
-  private val parameterTypes: Array<ExpectedType>? = null
+  private val parameterTypes: Array<ExpectedType>? = null,
+  /**
+   * Keys of the record fields, used when the type is [CppType.RECORD].
+   */
+  private val fieldKeys: Array<String>? = null
 ) {
   /**
    * The representation of the type.
@@ -33,6 +37,9 @@ class SingleType(
   @DoNotStrip
   fun getSecondParameterType() = parameterTypes?.get(1)
 
+  @DoNotStrip
+  fun getFieldKeys() = fieldKeys
+
   override fun equals(other: Any?): Boolean {
     if (this === other) {
       return true
@@ -50,6 +57,9 @@ class SingleType(
     if (!parameterTypes.contentEquals(other.parameterTypes)) {
       return false
     }
+    if (!fieldKeys.contentEquals(other.fieldKeys)) {
+      return false
+    }
 
     return true
   }
@@ -57,6 +67,7 @@ class SingleType(
   override fun hashCode(): Int {
     var result = expectedCppType.hashCode()
     result = 31 * result + (parameterTypes?.contentHashCode() ?: 0)
+    result = 31 * result + (fieldKeys?.contentHashCode() ?: 0)
     return result
   }
 
@@ -88,7 +99,8 @@ class SingleType(
 
       return SingleType(
         first.expectedCppType,
-        parameters.toTypedArray()
+        parameters.toTypedArray(),
+        first.fieldKeys
       )
     }
   }
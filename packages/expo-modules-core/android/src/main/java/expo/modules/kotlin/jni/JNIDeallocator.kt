@@ -47,6 +47,20 @@ class JNIDeallocator(shouldCreateDestructorThread: Boolean = true) : AutoCloseab
     destructorMap[phantomRef] = destructible.getHybridDataForJNIDeallocator()
   }
 
+  /**
+   * Adds the first [count] references from the given array to the internal registry at once.
+   * Used by the native code to register many converted values, like array buffers, in a single call.
+   * Each reference is still tracked separately, so it saves only the calls and the locking.
+   */
+  @DoNotStrip
+  fun addReferences(destructibles: Array<Destructible?>, count: Int): Unit = synchronized(this) {
+    for (i in 0 until count) {
+      val destructible = destructibles[i] ?: continue
+      val phantomRef = PhantomReference(destructible, referenceQueue)
+      destructorMap[phantomRef] = destructible.getHybridDataForJNIDeallocator()
+    }
+  }
+
   /**
    * Deallocates valid references and clears the internal registry.
    */
@@ -30,6 +30,38 @@ fun interface JNIFunctionBody {
   fun invoke(args: Array<Any?>): Any?
 }
 
+/**
+ * It's a wrapper for a promise-less function that takes only numbers and booleans.
+ * The cpp code passes all arguments as unboxed doubles (booleans as `0` or `1`) when their JS types match the expected ones.
+ * Otherwise, it falls back to [JNIFunctionBody.invoke]. This saves the JNI calls that box each argument
+ * and build the arguments array, but the implementation may still box them to call a generic function.
+ * If you want to modify it, please don't forget to change the corresponding jni::JavaClass.
+ */
+@DoNotStrip
+interface JNIPrimitiveFunctionBody : JNIFunctionBody {
+  @DoNotStrip
+  fun invokeWithPrimitives(): Any?
+
+  @DoNotStrip
+  fun invokeWithPrimitives(arg0: Double): Any?
+
+  @DoNotStrip
+  fun invokeWithPrimitives(arg0: Double, arg1: Double): Any?
+
+  @DoNotStrip
+  fun invokeWithPrimitives(arg0: Double, arg1: Double, arg2: Double): Any?
+
+  @DoNotStrip
+  fun invokeWithPrimitives(arg0: Double, arg1: Double, arg2: Double, arg3: Double): Any?
+
+  companion object {
+    /**
+     * Has to be in sync with `JNIPrimitiveFunctionBody::maxArgsCount`.
+     */
+    const val MAX_ARGS_COUNT = 4
+  }
+}
+
 /**
  * It's a wrapper for a promise function that will be invoked from JS.
  * This interface is intended to be passed to cpp code.
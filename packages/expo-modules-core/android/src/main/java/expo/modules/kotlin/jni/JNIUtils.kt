@@ -1,13 +1,27 @@
 package expo.modules.kotlin.jni
 
+import java.nio.ByteBuffer
+import java.util.concurrent.ConcurrentHashMap
+
 @Suppress("KotlinJniMissingFunction")
 class JNIUtils {
   companion object {
+    private val eventIds = ConcurrentHashMap<String, Int>()
+
+    /**
+     * Returns the ID of the given event name, which is passed to [emitEvent] instead of the name.
+     * IDs are cached, so each name crosses JNI only once.
+     */
+    @JvmStatic
+    fun getEventId(eventName: String): Int {
+      return eventIds[eventName] ?: eventIds.getOrPut(eventName) { internEventName(eventName) }
+    }
+
     @JvmStatic
     external fun emitEvent(
       jsiThis: JavaScriptObject,
       jsiContext: JSIContext,
-      eventName: String,
+      eventId: Int,
       eventBody: Array<Any?>
     )
 
@@ -15,7 +29,7 @@ class JNIUtils {
     external fun emitEvent(
       jsiThis: JavaScriptWeakObject,
       jsiContext: JSIContext,
-      eventName: String,
+      eventId: Int,
       eventBody: Array<Any?>
     )
 
@@ -23,8 +37,26 @@ class JNIUtils {
     external fun emitEvent(
       jsiThis: JavaScriptModuleObject,
       jsiContext: JSIContext,
-      eventName: String,
+      eventId: Int,
       eventBody: Map<String, Any?>?
     )
+
+    @JvmStatic
+    external fun emitEvent(
+      jsiThis: JavaScriptModuleObject,
+      jsiContext: JSIContext,
+      eventId: Int,
+      payloadSchemaId: Int,
+      payload: ByteBuffer
+    )
+
+    /**
+     * Registers the layout of binary event payloads and returns its ID.
+     */
+    @JvmStatic
+    external fun registerEventPayloadSchema(fieldNames: Array<String>, fieldTypes: IntArray): Int
+
+    @JvmStatic
+    private external fun internEventName(eventName: String): Int
   }
 }
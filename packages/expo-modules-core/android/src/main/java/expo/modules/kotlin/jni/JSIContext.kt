@@ -2,6 +2,7 @@ package expo.modules.kotlin.jni
 
 import com.facebook.jni.HybridData
 import expo.modules.core.interfaces.DoNotStrip
+import expo.modules.kotlin.events.EventDeliveryPolicy
 import expo.modules.kotlin.exception.JavaScriptEvaluateException
 import expo.modules.kotlin.jni.decorators.JSDecoratorsBridgingObject
 import expo.modules.kotlin.runtime.Runtime
@@ -66,7 +67,84 @@ class JSIContext @DoNotStrip internal constructor(
    */
   external fun drainJSEventLoop()
 
-  external fun setNativeStateForSharedObject(id: Int, js: JavaScriptObject)
+  /**
+   * Sets how events with the given name are delivered to JavaScript by emitters that don't have their own policy.
+   * @param sampleIntervalMs minimum time between delivered events, used only with [EventDeliveryPolicy.SAMPLE]
+   */
+  fun setEventDeliveryPolicy(eventName: String, policy: EventDeliveryPolicy, sampleIntervalMs: Long = 0) {
+    setEventDeliveryPolicy(JNIUtils.getEventId(eventName), policy.value, sampleIntervalMs)
+  }
+
+  /**
+   * Sets how events with the given name emitted by the given module are delivered to JavaScript.
+   * It takes precedence over the policy set for all emitters.
+   */
+  fun setEventDeliveryPolicy(module: JavaScriptModuleObject, eventName: String, policy: EventDeliveryPolicy, sampleIntervalMs: Long = 0) {
+    setModuleEventDeliveryPolicy(module, JNIUtils.getEventId(eventName), policy.value, sampleIntervalMs)
+  }
+
+  /**
+   * Sets how events with the given name emitted to the given object, e.g. by a shared object, are delivered to JavaScript.
+   * It takes precedence over the policy set for all emitters and it's forgotten once the object is deallocated.
+   */
+  fun setEventDeliveryPolicy(jsObject: JavaScriptWeakObject, eventName: String, policy: EventDeliveryPolicy, sampleIntervalMs: Long = 0) {
+    setWeakObjectEventDeliveryPolicy(jsObject, JNIUtils.getEventId(eventName), policy.value, sampleIntervalMs)
+  }
+
+  /**
+   * Lets the native module table know that modules were registered or removed, so it's reloaded on next access.
+   */
+  internal fun onModulesChanged() {
+    if (mHybridData.isValid) {
+      onModulesChangedNative()
+    }
+  }
+
+  private external fun onModulesChangedNative()
+
+  /**
+   * Detaches all wrappers of JS values, like [JavaScriptObject], created in this runtime.
+   * They release their JS values and throw when they're used.
+   */
+  internal fun detachJSIHandles() {
+    if (mHybridData.isValid) {
+      detachJSIHandlesNative()
+    }
+  }
+
+  private external fun detachJSIHandlesNative()
+
+  private external fun setEventDeliveryPolicy(eventId: Int, policy: Int, sampleIntervalMs: Long)
+
+  private external fun setModuleEventDeliveryPolicy(module: JavaScriptModuleObject, eventId: Int, policy: Int, sampleIntervalMs: Long)
+
+  private external fun setWeakObjectEventDeliveryPolicy(jsObject: JavaScriptWeakObject, eventId: Int, policy: Int, sampleIntervalMs: Long)
+
+  /**
+   * Registers the shared object in the native registry and attaches its native state to the given JS object.
+   * @return the ID assigned to the shared object
+   */
+  external fun setNativeStateForSharedObject(js: JavaScriptObject): Int
+
+  /**
+   * Checks whether the given ID belonged to a shared object that has already been released.
+   */
+  external fun wasSharedObjectReleased(id: Int): Boolean
+
+  /**
+   * Returns the number of shared objects that are currently alive in this runtime.
+   */
+  external fun getLiveSharedObjectsCount(): Int
+
+  /**
+   * Returns the highest number of shared objects that were alive at the same time in this runtime.
+   */
+  external fun getPeakSharedObjectsCount(): Int
+
+  /**
+   * Returns the number of wrappers of JS values, like [JavaScriptObject], that are still attached to this runtime.
+   */
+  external fun getJSIHandlesCount(): Int
 
   /**
    * Installs `SharedObject.__resolveInWorklet` in this runtime.
@@ -161,6 +239,15 @@ class JSIContext @DoNotStrip internal constructor(
       ?.delete(SharedObjectId(id))
   }
 
+  @Suppress("unused")
+  @DoNotStrip
+  fun deleteSharedObjects(ids: IntArray) {
+    runtimeHolder
+      .get()
+      ?.sharedObjectRegistry
+      ?.delete(ids)
+  }
+
   @Suppress("unused")
   @DoNotStrip
   fun registerClass(native: Class<*>, js: JavaScriptObject) {
@@ -14,7 +14,13 @@ class JavaScriptFunction<ReturnType : Any?> @DoNotStrip private constructor(@DoN
   @PublishedApi
   internal var returnType: TypeDescriptor? = null
 
-  fun isValid() = mHybridData.isValid
+  /**
+   * Returns whether the wrapper still holds its JS value.
+   * Wrappers are detached when the runtime they come from is torn down.
+   */
+  fun isValid() = mHybridData.isValid && isAttached()
+
+  private external fun isAttached(): Boolean
 
   private external fun invoke(thisValue: JavaScriptObject?, args: Array<Any?>, expectedReturnType: ExpectedType): Any?
 
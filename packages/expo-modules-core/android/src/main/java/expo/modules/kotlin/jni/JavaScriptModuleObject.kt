@@ -32,6 +32,26 @@ class JavaScriptModuleObject(
 
   external fun decorate(decorator: JSDecoratorsBridgingObject)
 
+  /**
+   * Counters describing how the function was called from JavaScript.
+   */
+  internal data class FunctionCallStats(
+    val calls: Long,
+    val primitiveCalls: Long,
+    val reusedArgsArrays: Long,
+    val allocatedArgsArrays: Long
+  )
+
+  /**
+   * Returns the call counters of the function with the given name or `null` if the module doesn't have such function.
+   */
+  internal fun getFunctionCallStats(functionName: String): FunctionCallStats? {
+    val stats = getFunctionCallStatsNative(functionName) ?: return null
+    return FunctionCallStats(stats[0], stats[1], stats[2], stats[3])
+  }
+
+  private external fun getFunctionCallStatsNative(functionName: String): LongArray?
+
   @Throws(Throwable::class)
   protected fun finalize() {
     mHybridData.resetNative()
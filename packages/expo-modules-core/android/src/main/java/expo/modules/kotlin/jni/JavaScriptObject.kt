@@ -30,7 +30,13 @@ open class JavaScriptObject @DoNotStrip internal constructor(@DoNotStrip private
     Writable(1 shl 2)
   }
 
-  fun isValid() = mHybridData.isValid
+  /**
+   * Returns whether the wrapper still holds its JS value.
+   * Wrappers are detached when the runtime they come from is torn down.
+   */
+  fun isValid() = mHybridData.isValid && isAttached()
+
+  private external fun isAttached(): Boolean
 
   external fun hasProperty(name: String): Boolean
   external fun getProperty(name: String): JavaScriptValue
@@ -11,7 +11,14 @@ import expo.modules.kotlin.types.descriptors.typeDescriptorOf
 @Suppress("KotlinJniMissingFunction")
 @DoNotStrip
 class JavaScriptValue @DoNotStrip private constructor(@DoNotStrip private val mHybridData: HybridData) : Destructible {
-  fun isValid() = mHybridData.isValid
+  /**
+   * Returns whether the wrapper still holds its JS value.
+   * Wrappers are detached when the runtime they come from is torn down.
+   */
+  fun isValid() = mHybridData.isValid && isAttached()
+
+  private external fun isAttached(): Boolean
+
   external fun kind(): String
 
   external fun isNull(): Boolean
@@ -23,7 +23,7 @@ class MainRuntimeInstaller(
       jsRuntimePointer,
       runtimeContext.deallocator,
       jsInvokerHolder
-    )
+    ).also(::observeModuleRegistry)
   }
 
   fun install(
@@ -40,6 +40,17 @@ class MainRuntimeInstaller(
       if (reactContext != null) {
         it.setJSHeapAccessExecutor(MainJSHeapAccessExecutor(reactContext))
       }
+      observeModuleRegistry(it)
+    }
+  }
+
+  /**
+   * Reloads the module table of the installed runtime whenever modules are registered or removed.
+   */
+  private fun observeModuleRegistry(jsiContext: JSIContext) {
+    val weakJSIContext = jsiContext.weak()
+    runtimeContext.appContext?.registry?.onModulesChanged = {
+      weakJSIContext.get()?.onModulesChanged()
     }
   }
 
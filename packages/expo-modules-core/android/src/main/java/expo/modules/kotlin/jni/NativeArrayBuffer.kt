@@ -48,6 +48,15 @@ class NativeArrayBuffer : Destructible {
    */
   fun copy(): NativeArrayBuffer = copyOf(this)
 
+  /**
+   * Releases the native part of this ArrayBuffer, so the buffer can no longer be used.
+   * For pooled buffers, the memory goes back to the pool once it's also released by JavaScript,
+   * instead of waiting for this object to be garbage collected.
+   */
+  fun recycle() {
+    mHybridData.resetNative()
+  }
+
   @Throws(Throwable::class)
   protected fun finalize() {
     mHybridData.resetNative()
@@ -66,6 +75,22 @@ class NativeArrayBuffer : Destructible {
       return NativeArrayBuffer(buffer)
     }
 
+    /**
+     * Allocate a new zero-filled [NativeArrayBuffer] with the given [size] using memory from a native pool.
+     * The memory is reused by next pooled buffers once this buffer is released, either by calling [recycle]
+     * or when it's garbage collected. The buffer returned by [toDirectBuffer] points into that memory,
+     * so it must not be used after this buffer is released.
+     */
+    fun allocatePooled(size: Int): NativeArrayBuffer {
+      if (size < 0) {
+        throw Exceptions.IllegalArgument("ArrayBuffer size cannot be negative")
+      }
+      return allocatePooledNative(size)
+    }
+
+    @JvmStatic
+    private external fun allocatePooledNative(size: Int): NativeArrayBuffer
+
     /**
      * Wrap the given [ByteBuffer] in a new **owning** `ArrayBuffer`.
      * The buffer must be direct, otherwise the function throws.
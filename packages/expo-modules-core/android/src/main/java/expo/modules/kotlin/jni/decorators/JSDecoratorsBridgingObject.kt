@@ -15,6 +15,7 @@ import expo.modules.kotlin.jni.JNIAsyncFunctionBody
 import expo.modules.kotlin.jni.JNIDeallocator
 import expo.modules.kotlin.jni.JNINoArgsFunctionBody
 import expo.modules.kotlin.jni.JNIFunctionBody
+import expo.modules.kotlin.jni.ReturnType
 import expo.modules.kotlin.modules.DEFAULT_MODULE_VIEW
 import expo.modules.kotlin.objects.ObjectDefinitionData
 import expo.modules.kotlin.tracing.trace
@@ -60,6 +61,7 @@ class JSDecoratorsBridgingObject(jniDeallocator: JNIDeallocator) : Destructible
     name: String,
     getterTakesOwner: Boolean,
     getterExpectedType: Array<ExpectedType>,
+    getterCppReturnType: Int,
     getter: JNIFunctionBody?,
     setterTakesOwner: Boolean,
     setterExpectedType: Array<ExpectedType>,
@@ -92,6 +94,7 @@ class JSDecoratorsBridgingObject(jniDeallocator: JNIDeallocator) : Destructible
       "__expo_module_name__",
       false,
       emptyArray(),
+      ReturnType.STRING.value,
       { name },
       false,
       emptyArray(),
@@ -0,0 +1,37 @@
+@file:Suppress("KotlinJniMissingFunction")
+
+package expo.modules.kotlin.jni.tests
+
+/**
+ * Uses the native JNI worker pool from threads that are not attached to the JVM,
+ * which can't be created from Kotlin.
+ * Used for testing purposes only.
+ */
+internal class JNIWorkerPoolTester {
+  companion object {
+    /**
+     * @return whether a task run from an attached thread was run right away on that thread
+     */
+    @JvmStatic
+    external fun runAttachedOnAttachedThread(): Boolean
+
+    /**
+     * @return whether a task run from a detached thread was run on another thread attached to the JVM
+     */
+    @JvmStatic
+    external fun runAttachedOnDetachedThread(): Boolean
+
+    /**
+     * Runs a task throwing an error with the given [message] from a detached thread.
+     * @return the message of the error rethrown to the detached thread or `null` if nothing was rethrown
+     */
+    @JvmStatic
+    external fun runFailingTaskOnDetachedThread(message: String): String?
+
+    /**
+     * Creates a global reference to the [obj] and releases it from a detached thread.
+     */
+    @JvmStatic
+    external fun releaseOnDetachedThread(obj: Any)
+  }
+}
@@ -0,0 +1,35 @@
+@file:Suppress("KotlinJniMissingFunction")
+
+package expo.modules.kotlin.jni.tests
+
+import com.facebook.jni.HybridData
+import expo.modules.core.interfaces.DoNotStrip
+
+/**
+ * Drives a native promise settlement queue, so the batching can be tested without async functions.
+ * Drains are run only when [runScheduledDrains] is called.
+ * Used for testing purposes only.
+ */
+internal class PromiseSettlementQueueTester {
+  // Has to be called "mHybridData" - fbjni uses it via reflection
+  @DoNotStrip
+  private val mHybridData = initHybrid()
+
+  private external fun initHybrid(): HybridData
+
+  /**
+   * Enqueues a settlement that records the given [id], and then throws if [shouldThrow] is set.
+   */
+  external fun enqueue(id: Int, shouldThrow: Boolean)
+
+  /**
+   * Runs the scheduled drains in the runtime created by [RuntimeHolder].
+   * @return the number of drains that were run
+   */
+  external fun runScheduledDrains(runtimePointer: Long): Int
+
+  /**
+   * Returns the IDs of settlements in the order they were run.
+   */
+  external fun getSettledIds(): IntArray
+}
@@ -4,6 +4,9 @@ import android.os.Bundle
 import expo.modules.kotlin.AppContext
 import expo.modules.kotlin.runtime.Runtime
 import expo.modules.kotlin.convertToString
+import expo.modules.kotlin.events.EventPayload
+import expo.modules.kotlin.events.EventPayloadSchema
+import expo.modules.kotlin.events.KModuleEventEmitterWrapper
 import expo.modules.kotlin.providers.AppContextProvider
 import expo.modules.kotlin.tracing.trace
 import expo.modules.kotlin.types.Enumerable
@@ -51,6 +54,17 @@ abstract class Module : AppContextProvider {
     moduleEventEmitter?.emit(name, body)
   }
 
+  /**
+   * Sends the event with a binary payload, which is decoded into an object on the JavaScript side.
+   * See [EventPayloadSchema]. Emitters that can't send binary payloads get the payload converted to a map.
+   */
+  fun sendEvent(name: String, payload: EventPayload) {
+    when (val emitter = moduleEventEmitter) {
+      is KModuleEventEmitterWrapper -> emitter.emit(name, payload)
+      else -> emitter?.emit(name, payload.toMap())
+    }
+  }
+
   fun <T> sendEvent(enum: T, body: Bundle? = Bundle.EMPTY) where T : Enumerable, T : Enum<T> {
     moduleEventEmitter?.emit(enum.convertToString(), body)
   }
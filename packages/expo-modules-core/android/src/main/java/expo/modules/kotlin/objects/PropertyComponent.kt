@@ -3,6 +3,7 @@ package expo.modules.kotlin.objects
 import expo.modules.kotlin.AppContext
 import expo.modules.kotlin.functions.SyncFunctionComponent
 import expo.modules.kotlin.jni.JNIFunctionBody
+import expo.modules.kotlin.jni.ReturnType
 import expo.modules.kotlin.jni.decorators.JSDecoratorsBridgingObject
 import expo.modules.kotlin.types.JSTypeConverterProvider
 
@@ -26,10 +27,19 @@ class PropertyComponent(
    * Attaches property to the provided js object.
    */
   fun attachToJSObject(appContext: AppContext, jsObject: JSDecoratorsBridgingObject) {
+    // When the getter declares its return type, the result is converted by the matching converter,
+    // so the C++ side can convert it without checking its class.
+    val getterCppReturnType = getter?.returnType?.cppType ?: ReturnType.UNKNOWN
     val jniGetter = if (getter != null) {
+      val returnType = getter.returnType
+      val declaresReturnType = getterCppReturnType != ReturnType.UNKNOWN
       JNIFunctionBody { args ->
         val result = getter.callUserImplementation(args, appContext)
-        return@JNIFunctionBody JSTypeConverterProvider.convertToJSValue(result, useExperimentalConverter = true)
+        return@JNIFunctionBody if (declaresReturnType) {
+          returnType.convertToJS(result)
+        } else {
+          JSTypeConverterProvider.convertToJSValue(result, useExperimentalConverter = true)
+        }
       }
     } else {
       null
@@ -48,6 +58,7 @@ class PropertyComponent(
       name,
       getter?.takesOwner == true,
       getter?.getCppRequiredTypes()?.toTypedArray() ?: emptyArray(),
+      getterCppReturnType.value,
       jniGetter,
       setter?.takesOwner == true,
       setter?.getCppRequiredTypes()?.toTypedArray() ?: emptyArray(),
@@ -12,12 +12,14 @@ import expo.modules.kotlin.exception.RecordCastException
 import expo.modules.kotlin.exception.exceptionDecorator
 import expo.modules.kotlin.jni.CppType
 import expo.modules.kotlin.jni.ExpectedType
+import expo.modules.kotlin.jni.SingleType
 import expo.modules.kotlin.recycle
 import expo.modules.kotlin.types.ConverterContext
 import expo.modules.kotlin.types.DynamicAwareTypeConverters
 import expo.modules.kotlin.types.TypeConverter
 import expo.modules.kotlin.types.TypeConverterProvider
 import expo.modules.kotlin.types.TypeConverterProviderImpl
+import expo.modules.kotlin.types.ValueOrUndefined
 import expo.modules.kotlin.types.descriptors.TypeDescriptor
 import expo.modules.kotlin.types.descriptors.toRawTypeDescriptor
 import expo.modules.kotlin.types.descriptors.toTypeDescriptor
@@ -41,6 +43,17 @@ abstract class RecordConversionStrategy<T : Record>(
 
   abstract fun convertFromReadableMap(jsMap: ReadableMap, context: ConverterContext, forceConversion: Boolean): T
   abstract fun convertFromMap(map: Map<String, Any?>, context: ConverterContext, forceConversion: Boolean): T
+
+  /**
+   * Keys of the record fields. The cpp code uses them to pass field values as an array in the same order.
+   */
+  abstract val fieldKeys: Array<String>
+
+  /**
+   * Converts values of the fields ordered as in [fieldKeys].
+   * Missing fields are represented as [ValueOrUndefined.Undefined].
+   */
+  abstract fun convertFromFields(values: Array<Any?>, context: ConverterContext, forceConversion: Boolean): T
 }
 
 class ReflectionRecordConversionStrategy<T : Record>(
@@ -109,6 +122,14 @@ class ReflectionRecordConversionStrategy<T : Record>(
     return instance as T
   }
 
+  private val orderedPropertyDescriptors by lazy {
+    propertyDescriptors.entries.toList()
+  }
+
+  override val fieldKeys: Array<String> by lazy {
+    orderedPropertyDescriptors.map { it.value.key }.toTypedArray()
+  }
+
   override fun convertFromMap(map: Map<String, Any?>, context: ConverterContext, forceConversion: Boolean): T {
     val kClass = typeDescriptor.jClass.kotlin
     val instance = getObjectConstructor(kClass).construct()
@@ -125,32 +146,63 @@ class ReflectionRecordConversionStrategy<T : Record>(
           return@forEach
         }
 
-        val rawValue = map[key]
-        // Normalize numeric types since JS numbers come as Double in Kotlin Maps
-        val value = if (rawValue is Number) {
-          when (property.returnType.classifier) {
-            Int::class -> rawValue.toInt()
-            Long::class -> rawValue.toLong()
-            Float::class -> rawValue.toFloat()
-            Double::class -> rawValue.toDouble()
-            else -> rawValue
-          }
-        } else {
-          rawValue
-        }
-        val javaField = property.javaField!!
+        setField(instance, property, descriptor, map[key], context, forceConversion)
+      }
+
+    @Suppress("UNCHECKED_CAST")
+    return instance as T
+  }
 
-        val casted = exceptionDecorator({ cause -> FieldCastException(property.name, property.returnType, typeDescriptor, cause) }) {
-          descriptor.typeConverter.convert(value, context, forceConversion)
+  override fun convertFromFields(values: Array<Any?>, context: ConverterContext, forceConversion: Boolean): T {
+    val kClass = typeDescriptor.jClass.kotlin
+    val instance = getObjectConstructor(kClass).construct()
+
+    orderedPropertyDescriptors.forEachIndexed { index, (property, descriptor) ->
+      val value = values[index]
+      if (value === ValueOrUndefined.Undefined) {
+        if (descriptor.isRequired) {
+          throw FieldRequiredException(property)
         }
 
-        javaField.isAccessible = true
-        javaField.set(instance, casted)
+        return@forEachIndexed
       }
 
+      setField(instance, property, descriptor, value, context, forceConversion)
+    }
+
     @Suppress("UNCHECKED_CAST")
     return instance as T
   }
+
+  private fun setField(
+    instance: Any,
+    property: KProperty1<out Any, *>,
+    descriptor: PropertyDescriptor,
+    rawValue: Any?,
+    context: ConverterContext,
+    forceConversion: Boolean
+  ) {
+    // Normalize numeric types since JS numbers come as Double in Kotlin Maps
+    val value = if (rawValue is Number) {
+      when (property.returnType.classifier) {
+        Int::class -> rawValue.toInt()
+        Long::class -> rawValue.toLong()
+        Float::class -> rawValue.toFloat()
+        Double::class -> rawValue.toDouble()
+        else -> rawValue
+      }
+    } else {
+      rawValue
+    }
+    val javaField = property.javaField!!
+
+    val casted = exceptionDecorator({ cause -> FieldCastException(property.name, property.returnType, typeDescriptor, cause) }) {
+      descriptor.typeConverter.convert(value, context, forceConversion)
+    }
+
+    javaField.isAccessible = true
+    javaField.set(instance, casted)
+  }
 }
 
 class IntrospectableRecordConversionStrategy<T : Record>(
@@ -238,6 +290,10 @@ class IntrospectableRecordConversionStrategy<T : Record>(
     return instance as T
   }
 
+  override val fieldKeys: Array<String> by lazy {
+    propertyDescriptors.map { it.key }.toTypedArray()
+  }
+
   override fun convertFromMap(map: Map<String, Any?>, context: ConverterContext, forceConversion: Boolean): T {
     val kClass = typeDescriptor.jClass.kotlin
     val instance = getObjectConstructor(kClass).construct()
@@ -251,30 +307,59 @@ class IntrospectableRecordConversionStrategy<T : Record>(
         return@forEach
       }
 
-      val rawValue = map[key]
-      // Normalize numeric types since JS numbers come as Double in Kotlin Maps
-      val value = if (rawValue is Number) {
-        when (property.typeDescriptor.jClass) {
-          Int::class.java -> rawValue.toInt()
-          Long::class.java -> rawValue.toLong()
-          Float::class.java -> rawValue.toFloat()
-          Double::class.java -> rawValue.toDouble()
-          else -> rawValue
-        }
-      } else {
-        rawValue
-      }
+      setField(instance, property, map[key], context, forceConversion)
+    }
 
-      val casted = exceptionDecorator({ cause -> FieldCastException(property.key, property.typeDescriptor, value, cause) }) {
-        property.typeConverter.convert(value, context, forceConversion)
+    @Suppress("UNCHECKED_CAST")
+    return instance as T
+  }
+
+  override fun convertFromFields(values: Array<Any?>, context: ConverterContext, forceConversion: Boolean): T {
+    val kClass = typeDescriptor.jClass.kotlin
+    val instance = getObjectConstructor(kClass).construct()
+
+    propertyDescriptors.forEachIndexed { index, property ->
+      val value = values[index]
+      if (value === ValueOrUndefined.Undefined) {
+        if (property.isRequired) {
+          throw FieldRequiredException(property.key)
+        }
+        return@forEachIndexed
       }
 
-      property.setter(instance, casted)
+      setField(instance, property, value, context, forceConversion)
     }
 
     @Suppress("UNCHECKED_CAST")
     return instance as T
   }
+
+  private fun setField(
+    instance: Any,
+    property: PropertyDescriptor,
+    rawValue: Any?,
+    context: ConverterContext,
+    forceConversion: Boolean
+  ) {
+    // Normalize numeric types since JS numbers come as Double in Kotlin Maps
+    val value = if (rawValue is Number) {
+      when (property.typeDescriptor.jClass) {
+        Int::class.java -> rawValue.toInt()
+        Long::class.java -> rawValue.toLong()
+        Float::class.java -> rawValue.toFloat()
+        Double::class.java -> rawValue.toDouble()
+        else -> rawValue
+      }
+    } else {
+      rawValue
+    }
+
+    val casted = exceptionDecorator({ cause -> FieldCastException(property.key, property.typeDescriptor, value, cause) }) {
+      property.typeConverter.convert(value, context, forceConversion)
+    }
+
+    property.setter(instance, casted)
+  }
 }
 
 class RecordTypeConverter<T : Record>(
@@ -304,11 +389,20 @@ class RecordTypeConverter<T : Record>(
       return conversionStrategy.convertFromMap(value as Map<String, Any?>, context, forceConversion)
     }
 
+    if (value is Array<*>) {
+      @Suppress("UNCHECKED_CAST")
+      return conversionStrategy.convertFromFields(value as Array<Any?>, context, forceConversion)
+    }
+
     @Suppress("UNCHECKED_CAST")
     return value as T
   }
 
-  override fun getCppRequiredTypes(): ExpectedType = ExpectedType(CppType.READABLE_MAP)
+  // Records are passed from cpp as an array of field values, read from the JS object using cached prop names,
+  // so the object isn't converted to `folly::dynamic` and `ReadableNativeMap` first and fields aren't looked up by name.
+  override fun getCppRequiredTypes(): ExpectedType = ExpectedType(
+    SingleType(CppType.RECORD, fieldKeys = conversionStrategy.fieldKeys)
+  )
 
   override fun isTrivial(): Boolean = false
 }
@@ -111,6 +111,7 @@ class MainRuntime(
     try {
       if (isJSIContextInitialized()) {
         jsiContext.getJSHeapAccessExecutor()?.invalidate()
+        jsiContext.detachJSIHandles()
       }
     } finally {
       deallocator.deallocate()
@@ -68,6 +68,12 @@ class WorkletRuntime(
   }
 
   override fun deallocate() {
-    deallocator.deallocate()
+    try {
+      if (isJSIContextInitialized()) {
+        jsiContext.detachJSIHandles()
+      }
+    } finally {
+      deallocator.deallocate()
+    }
   }
 }
@@ -70,7 +70,7 @@ open class SharedObject(runtime: Runtime? = null) {
       JNIUtils.emitEvent(
         jsObject,
         jniInterop,
-        event,
+        JNIUtils.getEventId(event),
         payload
           .map { JSTypeConverterProvider.convertToJSValue(it, useExperimentalConverter = true) }
           .toTypedArray()
@@ -36,18 +36,17 @@ const val sharedObjectIdPropertyName = "__expo_shared_object_id__"
 class SharedObjectRegistry(runtime: Runtime) {
   private val runtimeContextHolder = runtime.weak()
 
-  private var currentId: SharedObjectId = SharedObjectId(1)
-
   internal var pairs = mutableMapOf<SharedObjectId, SharedObjectPair>()
 
-  private fun pullNextId(): SharedObjectId = synchronized(this) {
-    val current = currentId
-    currentId = SharedObjectId(current.value + 1)
-    return current
-  }
-
   internal fun add(native: SharedObject, js: JavaScriptObject): SharedObjectId {
-    val id = pullNextId()
+    val runtimeContext = runtimeContextHolder.get() ?: throw Exceptions.AppContextLost()
+
+    // IDs are assigned by the native registry, which also attaches the native state to the JS object.
+    val id = SharedObjectId(
+      runtimeContext
+        .jsiContext
+        .setNativeStateForSharedObject(js)
+    )
     native.sharedObjectId = id
 
     // This property should be deprecated, but it's still used when passing as a view prop.
@@ -55,12 +54,6 @@ class SharedObjectRegistry(runtime: Runtime) {
     // but with the current implementation it's possible to use a raw object for registration.
     js.defineProperty(sharedObjectIdPropertyName, id.value)
 
-    val runtimeContext = runtimeContextHolder.get() ?: throw Exceptions.AppContextLost()
-
-    runtimeContext
-      .jsiContext
-      .setNativeStateForSharedObject(id.value, js)
-
     val size = native.getAdditionalMemoryPressure()
     // If the size is less or equal to 0, it means that the object doesn't require additional memory pressure.
     // We can skip the call to the JSI method.
@@ -93,9 +86,24 @@ class SharedObjectRegistry(runtime: Runtime) {
     }
   }
 
+  internal fun delete(ids: IntArray) {
+    val released = synchronized(this) {
+      ids.mapNotNull { pairs.remove(SharedObjectId(it)) }
+    }
+    released.forEach { (native, _) ->
+      native.sharedObjectId = SharedObjectId(0)
+      native.sharedObjectDidRelease()
+    }
+  }
+
   internal fun toNativeObject(id: SharedObjectId): SharedObject {
-    val native = pairs[id.ensureWasNotRelease()]?.first
-    return native ?: throw InvalidSharedObjectIdException()
+    // Registered objects are found in the map, so the native registry is only asked about the IDs missing from it.
+    val native = toNativeObjectOrNull(id)
+    if (native != null) {
+      return native
+    }
+    id.ensureWasNotRelease()
+    throw InvalidSharedObjectIdException()
   }
 
   internal fun toNativeObjectOrNull(id: SharedObjectId): SharedObject? {
@@ -125,8 +133,12 @@ class SharedObjectRegistry(runtime: Runtime) {
     }
   }
 
-  private fun SharedObjectId.ensureWasNotRelease() = apply {
-    if (!pairs.contains(this) && value != 0 && value < currentId.value) {
+  private fun SharedObjectId.ensureWasNotRelease() {
+    if (value == 0) {
+      return
+    }
+    val wasReleased = runtimeContextHolder.get()?.jsiContext?.wasSharedObjectReleased(value) ?: false
+    if (wasReleased) {
       throw UsingReleasedSharedObjectException()
     }
   }
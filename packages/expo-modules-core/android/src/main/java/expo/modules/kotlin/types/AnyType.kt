@@ -36,6 +36,11 @@ class AnyType(
   }
 
   fun getCppRequiredTypes(): ExpectedType = converter.getCppRequiredTypes()
+
+  /**
+   * Whether values converted on the C++ side are passed to the user implementation as they are.
+   */
+  fun isTrivial(): Boolean = converter.isTrivial()
 }
 
 inline fun <reified T> AnyType.inheritFrom(): Boolean {
@@ -16,10 +16,16 @@ class ReadableArgumentsTypeConverter() : DynamicAwareTypeConverters<ReadableArgu
   }
 
   override fun convertFromAny(value: Any, context: ConverterContext, forceConversion: Boolean): ReadableArguments {
-    return MapArguments((value as ReadableMap).toHashMap())
+    if (value is ReadableMap) {
+      return MapArguments(value.toHashMap())
+    }
+    // Maps created by the JSI converter already have the same shape as `ReadableMap.toHashMap()`.
+    @Suppress("UNCHECKED_CAST")
+    return MapArguments(value as Map<String, Any?>)
   }
 
-  override fun getCppRequiredTypes(): ExpectedType = ExpectedType(CppType.READABLE_MAP)
+  // Converted directly to a Java map, without going through folly::dynamic and `ReadableNativeMap`.
+  override fun getCppRequiredTypes(): ExpectedType = ExpectedType(CppType.JAVA_MAP)
 
   override fun isTrivial(): Boolean = false
 }
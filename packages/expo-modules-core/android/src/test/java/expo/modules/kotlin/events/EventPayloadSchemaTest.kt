@@ -0,0 +1,92 @@
+package expo.modules.kotlin.events
+
+import com.google.common.truth.Truth
+import expo.modules.kotlin.exception.CodedException
+import org.junit.Assert
+import org.junit.Test
+
+class EventPayloadSchemaTest {
+  private val schema = EventPayloadSchema {
+    double("latitude")
+    double("longitude")
+    float("accuracy")
+    long("timestamp")
+    boolean("isMocked")
+  }
+
+  @Test
+  fun `packs fields without padding`() {
+    Truth.assertThat(schema.size).isEqualTo(8 + 8 + 4 + 8 + 1)
+  }
+
+  @Test
+  fun `writes fields at their offsets`() {
+    val payload = schema.newPayload()
+      .putDouble("longitude", 2.5)
+      .putLong("timestamp", 42L)
+      .putBoolean("isMocked", true)
+
+    Truth.assertThat(payload.buffer.getDouble(8)).isEqualTo(2.5)
+    Truth.assertThat(payload.buffer.getLong(20)).isEqualTo(42L)
+    Truth.assertThat(payload.buffer.get(28)).isEqualTo(1.toByte())
+    Truth.assertThat(payload.buffer.getDouble(0)).isEqualTo(0.0)
+  }
+
+  @Test
+  fun `writes fields by their indices`() {
+    val timestampIndex = schema.fieldIndex("timestamp")
+    val payload = schema.newPayload()
+      .putLong(timestampIndex, 42L)
+      .putFloat(schema.fieldIndex("accuracy"), 1.5f)
+
+    Truth.assertThat(timestampIndex).isEqualTo(3)
+    Truth.assertThat(payload.buffer.getLong(20)).isEqualTo(42L)
+    Truth.assertThat(payload.buffer.getFloat(16)).isEqualTo(1.5f)
+
+    Assert.assertThrows(CodedException::class.java) {
+      payload.putDouble(timestampIndex, 1.0)
+    }
+    Assert.assertThrows(CodedException::class.java) {
+      payload.putInt(5, 1)
+    }
+  }
+
+  @Test
+  fun `rejects unknown and mistyped fields`() {
+    val payload = schema.newPayload()
+
+    Assert.assertThrows(CodedException::class.java) {
+      payload.putDouble("altitude", 1.0)
+    }
+    Assert.assertThrows(CodedException::class.java) {
+      payload.putInt("latitude", 1)
+    }
+  }
+
+  @Test
+  fun `converts payload to a map`() {
+    val payload = schema.newPayload()
+      .putDouble("latitude", 1.5)
+      .putFloat("accuracy", 2.5f)
+      .putLong("timestamp", 42L)
+      .putBoolean("isMocked", true)
+
+    Truth.assertThat(payload.toMap()).containsExactly(
+      "latitude", 1.5,
+      "longitude", 0.0,
+      "accuracy", 2.5f,
+      "timestamp", 42L,
+      "isMocked", true
+    ).inOrder()
+  }
+
+  @Test
+  fun `rejects duplicated fields`() {
+    Assert.assertThrows(CodedException::class.java) {
+      EventPayloadSchema {
+        int("value")
+        float("value")
+      }
+    }
+  }
+}
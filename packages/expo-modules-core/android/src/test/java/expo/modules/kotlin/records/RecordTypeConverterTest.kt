@@ -7,7 +7,10 @@ import com.google.common.truth.Truth
 import expo.modules.kotlin.EnumWithInt
 import expo.modules.kotlin.EnumWithString
 import expo.modules.kotlin.EnumWithoutParameter
+import expo.modules.kotlin.types.TypeConverterProviderImpl
+import expo.modules.kotlin.types.ValueOrUndefined
 import expo.modules.kotlin.types.convert
+import expo.modules.kotlin.types.descriptors.typeDescriptorOf
 import org.junit.Test
 import expo.modules.kotlin.types.OptimizedRecord
 
@@ -285,4 +288,75 @@ class RecordTypeConverterTest {
     Truth.assertThat(myRecord.enumWithInt).isEqualTo(EnumWithInt.VALUE1)
     Truth.assertThat(myRecord.enumWithString).isEqualTo(EnumWithString.VALUE3)
   }
+
+  @Test
+  fun `should convert java map created from JS object`() {
+    @OptimizedRecord
+    class InnerRecord : Record {
+      @Field
+      var name: String? = null
+    }
+
+    @OptimizedRecord
+    class MyRecord : Record {
+      @Field
+      var int: Int = 0
+
+      @Field
+      lateinit var points: List<Double>
+
+      @Field
+      lateinit var innerRecord: InnerRecord
+
+      @Field
+      var optionalString: String? = "default"
+    }
+
+    // The same shape as the one created by the cpp converter - numbers are always doubles.
+    val map = linkedMapOf<String, Any?>(
+      "int" to 10.0,
+      "points" to arrayListOf(1.0, 2.0),
+      "innerRecord" to linkedMapOf<String, Any?>("name" to null),
+      "optionalString" to null
+    )
+
+    val myRecord = convert<MyRecord>(map as Any?)
+
+    Truth.assertThat(myRecord.int).isEqualTo(10)
+    Truth.assertThat(myRecord.points).isEqualTo(listOf(1.0, 2.0))
+    Truth.assertThat(myRecord.innerRecord.name).isNull()
+    Truth.assertThat(myRecord.optionalString).isNull()
+  }
+
+  @Test
+  fun `should convert field values in the order of field keys`() {
+    @OptimizedRecord
+    class MyRecord : Record {
+      @Field
+      var int: Int = 0
+
+      @Field(key = "text")
+      var string: String = "default"
+
+      @Field
+      var optionalString: String? = "default"
+    }
+
+    val converter = TypeConverterProviderImpl.obtainTypeConverter(typeDescriptorOf<MyRecord>()) as RecordTypeConverter<*>
+    val fieldKeys = converter.conversionStrategy.fieldKeys
+    val values = fieldKeys.map { key ->
+      when (key) {
+        "int" -> 10.0
+        "text" -> ValueOrUndefined.Undefined
+        else -> null
+      }
+    }.toTypedArray()
+
+    val myRecord = convert<MyRecord>(values as Any?)
+
+    Truth.assertThat(fieldKeys.toSet()).isEqualTo(setOf("int", "text", "optionalString"))
+    Truth.assertThat(myRecord.int).isEqualTo(10)
+    Truth.assertThat(myRecord.string).isEqualTo("default")
+    Truth.assertThat(myRecord.optionalString).isNull()
+  }
 }
@@ -4,88 +4,197 @@
 
 #include <cxxreact/ErrorUtils.h>
 
+#include <algorithm>
+#include <deque>
+#include <mutex>
+#include <shared_mutex>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
 namespace expo::EventEmitter {
 
-#pragma mark - Listeners
+#pragma mark - Event names
+
+namespace {
 
-void Listeners::add(jsi::Runtime &runtime, const std::string& eventName, const jsi::Function &listener) noexcept {
-  listenersMap[eventName].emplace_back(runtime, listener);
+/**
+ Process-wide table of the interned event names. Names are never removed, so the references
+ returned by `getEventName` stay valid. `std::deque` doesn't move its elements when growing.
+ */
+struct EventNamesTable {
+  std::shared_mutex mutex;
+  std::deque<std::string> names;
+  std::unordered_map<std::string_view, EventId> ids;
+};
+
+EventNamesTable &getEventNamesTable() {
+  static EventNamesTable table;
+  return table;
 }
 
-void Listeners::remove(jsi::Runtime &runtime, const std::string& eventName, const jsi::Function &listener) noexcept {
-  if (!listenersMap.contains(eventName)) {
-    return;
+} // namespace
+
+EventId internEventName(const std::string &eventName) {
+  EventNamesTable &table = getEventNamesTable();
+  {
+    std::shared_lock lock(table.mutex);
+    auto iterator = table.ids.find(eventName);
+    if (iterator != table.ids.end()) {
+      return iterator->second;
+    }
+  }
+  std::unique_lock lock(table.mutex);
+  // Another thread could have registered the same name in the meantime.
+  auto iterator = table.ids.find(eventName);
+  if (iterator != table.ids.end()) {
+    return iterator->second;
   }
-  jsi::Value listenerValue(runtime, listener);
+  EventId eventId = static_cast<EventId>(table.names.size());
+  const std::string &storedName = table.names.emplace_back(eventName);
+  table.ids.emplace(storedName, eventId);
+  return eventId;
+}
 
-  listenersMap[eventName].remove_if([&](const jsi::Value &item) {
-    return jsi::Value::strictEquals(runtime, listenerValue, item);
-  });
+const std::string &getEventName(EventId eventId) {
+  EventNamesTable &table = getEventNamesTable();
+  std::shared_lock lock(table.mutex);
+  return table.names.at(eventId);
 }
 
-void Listeners::removeAll(const std::string& eventName) noexcept {
-  if (listenersMap.contains(eventName)) {
-    listenersMap[eventName].clear();
+#pragma mark - Listeners
+
+Listeners::EventListeners *Listeners::find(EventId eventId) noexcept {
+  for (EventListeners &eventListeners : events) {
+    if (eventListeners.eventId == eventId) {
+      return &eventListeners;
+    }
   }
+  return nullptr;
 }
 
-void Listeners::clear() noexcept {
-  listenersMap.clear();
+void Listeners::flush(EventListeners &eventListeners) noexcept {
+  if (eventListeners.emitDepth > 0) {
+    return;
+  }
+  std::erase_if(eventListeners.listeners, [](const Listener &listener) {
+    return listener.removed;
+  });
+  for (Listener &listener : eventListeners.pending) {
+    eventListeners.listeners.push_back(std::move(listener));
+  }
+  eventListeners.pending.clear();
 }
 
-size_t Listeners::listenersCount(const std::string& eventName) noexcept {
-  if (!listenersMap.contains(eventName)) {
-    return 0;
+void Listeners::add(jsi::Runtime &runtime, EventId eventId, const jsi::Function &listener) noexcept {
+  EventListeners *eventListeners = find(eventId);
+
+  if (!eventListeners) {
+    eventListeners = &events.emplace_back(EventListeners { .eventId = eventId });
   }
-  return listenersMap[eventName].size();
+
+  Listener entry { .function = jsi::Value(runtime, listener).getObject(runtime).getFunction(runtime) };
+
+  // Listeners added during the emission must not be called in that emission,
+  // and the vector that is being iterated over must not be reallocated.
+  if (eventListeners->emitDepth > 0) {
+    eventListeners->pending.push_back(std::move(entry));
+  } else {
+    eventListeners->listeners.push_back(std::move(entry));
+  }
+  eventListeners->count++;
 }
 
-void Listeners::call(jsi::Runtime &runtime, const std::string& eventName, const jsi::Object &thisObject, const jsi::Value *args, size_t count) noexcept {
-  if (!listenersMap.contains(eventName)) {
+void Listeners::remove(jsi::Runtime &runtime, EventId eventId, const jsi::Function &listener) noexcept {
+  EventListeners *eventListeners = find(eventId);
+
+  if (!eventListeners) {
     return;
   }
-  ListenersList &listenersList = listenersMap[eventName];
-  size_t listSize = listenersList.size();
+  for (Listener &entry : eventListeners->listeners) {
+    if (!entry.removed && jsi::Object::strictEquals(runtime, entry.function, listener)) {
+      entry.removed = true;
+      eventListeners->count--;
+    }
+  }
+  size_t pendingCount = std::erase_if(eventListeners->pending, [&](const Listener &entry) {
+    return jsi::Object::strictEquals(runtime, entry.function, listener);
+  });
+  eventListeners->count -= pendingCount;
 
-  if (listSize == 0) {
-    // Nothing to call.
+  flush(*eventListeners);
+}
+
+void Listeners::removeAll(EventId eventId) noexcept {
+  EventListeners *eventListeners = find(eventId);
+
+  if (!eventListeners) {
     return;
   }
-  if (listSize == 1) {
-    // The most common scenario – just call the only listener.
-    try {
-      listenersList
-        .front()
-        .asObject(runtime)
-        .asFunction(runtime)
-        .callWithThis(runtime, thisObject, args, count);
-    } catch (jsi::JSError& error) {
-      facebook::react::handleJSError(runtime, error, false);
-    }
+  for (Listener &entry : eventListeners->listeners) {
+    entry.removed = true;
+  }
+  eventListeners->pending.clear();
+  eventListeners->count = 0;
+
+  flush(*eventListeners);
+}
+
+void Listeners::clear() noexcept {
+  // The emission looks up its entry by index, so while any event is being emitted the entries must stay.
+  // Their listeners are removed instead and get erased once the emission finishes.
+  bool isEmitting = std::any_of(events.begin(), events.end(), [](const EventListeners &eventListeners) {
+    return eventListeners.emitDepth > 0;
+  });
+  if (!isEmitting) {
+    events.clear();
     return;
   }
-  // When there is more than one listener, we copy the list to a vector as the list may be modified during the loop.
-  std::vector<jsi::Function> listenersVector;
-  listenersVector.reserve(listSize);
+  for (EventListeners &eventListeners : events) {
+    removeAll(eventListeners.eventId);
+  }
+}
+
+size_t Listeners::listenersCount(EventId eventId) noexcept {
+  EventListeners *eventListeners = find(eventId);
+  return eventListeners ? eventListeners->count : 0;
+}
+
+void Listeners::call(jsi::Runtime &runtime, EventId eventId, const jsi::Object &thisObject, const jsi::Value *args, size_t count) noexcept {
+  EventListeners *eventListeners = find(eventId);
 
-  // Copy listeners to vector already as jsi::Function so we don't additionally copy jsi::Value
-  for (const jsi::Value &listener : listenersList) {
-    listenersVector.push_back(listener.asObject(runtime).asFunction(runtime));
+  if (!eventListeners || eventListeners->count == 0) {
+    // Nothing to call.
+    return;
   }
 
-  // Call listeners from the vector. The list can be modified by the listeners but it will not affect this loop,
-  // i.e. newly added listeners will not be called and removed listeners will be called one last time.
+  // The listeners may add or remove other listeners. Instead of copying the list, we remember its size and
+  // increase the emission depth, so that newly added listeners go to the pending list and removed ones are only marked.
+  // That means newly added listeners will not be called and removed listeners will be called one last time.
   // This is compliant with the EventEmitter in Node.js
-  for (const jsi::Function &listener : listenersVector) {
+  // Note that `events` may grow while calling the listeners, so we look up the entry by index.
+  size_t eventIndex = eventListeners - events.data();
+  size_t listSize = eventListeners->listeners.size();
+
+  eventListeners->emitDepth++;
+
+  for (size_t i = 0; i < listSize; i++) {
     // As opposed to Node.js and fbemitter, when the listener throws an error the behavior is the same as on web.
     // That is, it doesn't stop the execution of subsequent listeners and the error is not propagated to the `emit` function.
     // The motivation behind this is that errors thrown from a module or user's code shouldn't affect other modules' behavior.
     try {
-      listener.callWithThis(runtime, thisObject, args, count);
+      events[eventIndex]
+        .listeners[i]
+        .function
+        .callWithThis(runtime, thisObject, args, count);
     } catch (jsi::JSError& error) {
       facebook::react::handleJSError(runtime, error, false);
     }
   }
+
+  EventListeners &emittedListeners = events[eventIndex];
+  emittedListeners.emitDepth--;
+  flush(emittedListeners);
 }
 
 #pragma mark - NativeState
@@ -115,7 +224,7 @@ NativeState::Shared NativeState::get(jsi::Runtime &runtime, const jsi::Object &o
 
 #pragma mark - Utils
 
-void callObservingFunction(jsi::Runtime &runtime, const jsi::Object &object, const char* functionName, const std::string& eventName) {
+void callObservingFunction(jsi::Runtime &runtime, const jsi::Object &object, const char* functionName, EventId eventId) {
   jsi::Value fnValue = object.getProperty(runtime, functionName);
 
   if (!fnValue.isObject()) {
@@ -127,71 +236,65 @@ void callObservingFunction(jsi::Runtime &runtime, const jsi::Object &object, con
     .getObject(runtime)
     .asFunction(runtime)
     .callWithThis(runtime, object, {
-      jsi::Value(runtime, jsi::String::createFromUtf8(runtime, eventName))
+      jsi::Value(runtime, jsi::String::createFromUtf8(runtime, getEventName(eventId)))
     });
 }
 
-void addListener(jsi::Runtime &runtime, const jsi::Object &emitter, const std::string &eventName, const jsi::Function &listener) {
+void addListener(jsi::Runtime &runtime, const jsi::Object &emitter, EventId eventId, const jsi::Function &listener) {
   if (NativeState::Shared state = NativeState::get(runtime, emitter, true)) {
-    state->listeners.add(runtime, eventName, listener);
+    state->listeners.add(runtime, eventId, listener);
 
-    if (state->listeners.listenersCount(eventName) == 1) {
-      callObservingFunction(runtime, emitter, "__expo_onStartListeningToEvent", eventName);
-      callObservingFunction(runtime, emitter, "startObserving", eventName);
+    if (state->listeners.listenersCount(eventId) == 1) {
+      callObservingFunction(runtime, emitter, "__expo_onStartListeningToEvent", eventId);
+      callObservingFunction(runtime, emitter, "startObserving", eventId);
     }
   }
 }
 
-void removeListener(jsi::Runtime &runtime, const jsi::Object &emitter, const std::string &eventName, const jsi::Function &listener) {
+void removeListener(jsi::Runtime &runtime, const jsi::Object &emitter, EventId eventId, const jsi::Function &listener) {
   if (NativeState::Shared state = NativeState::get(runtime, emitter, false)) {
-    size_t listenersCountBefore = state->listeners.listenersCount(eventName);
+    size_t listenersCountBefore = state->listeners.listenersCount(eventId);
 
-    state->listeners.remove(runtime, eventName, listener);
+    state->listeners.remove(runtime, eventId, listener);
 
-    if (listenersCountBefore >= 1 && state->listeners.listenersCount(eventName) == 0) {
-      callObservingFunction(runtime, emitter, "__expo_onStopListeningToEvent", eventName);
-      callObservingFunction(runtime, emitter, "stopObserving", eventName);
+    if (listenersCountBefore >= 1 && state->listeners.listenersCount(eventId) == 0) {
+      callObservingFunction(runtime, emitter, "__expo_onStopListeningToEvent", eventId);
+      callObservingFunction(runtime, emitter, "stopObserving", eventId);
     }
   }
 }
 
-void removeAllListeners(jsi::Runtime &runtime, const jsi::Object &emitter, const std::string &eventName) {
+void removeAllListeners(jsi::Runtime &runtime, const jsi::Object &emitter, EventId eventId) {
   if (NativeState::Shared state = NativeState::get(runtime, emitter, false)) {
-    size_t listenersCountBefore = state->listeners.listenersCount(eventName);
+    size_t listenersCountBefore = state->listeners.listenersCount(eventId);
 
-    state->listeners.removeAll(eventName);
+    state->listeners.removeAll(eventId);
 
     if (listenersCountBefore >= 1) {
-      callObservingFunction(runtime, emitter, "__expo_onStopListeningToEvent", eventName);
-      callObservingFunction(runtime, emitter, "stopObserving", eventName);
+      callObservingFunction(runtime, emitter, "__expo_onStopListeningToEvent", eventId);
+      callObservingFunction(runtime, emitter, "stopObserving", eventId);
     }
   }
 }
 
-void emitEvent(jsi::Runtime &runtime, const jsi::Object &emitter, const std::string &eventName, const jsi::Value *args, size_t count) {
-  if (NativeState::Shared state = NativeState::get(runtime, emitter, false)) {
-    state->listeners.call(runtime, eventName, emitter, args, count);
-  }
-}
-
-size_t getListenerCount(jsi::Runtime &runtime, const jsi::Object &emitter, const std::string &eventName) {
+size_t getListenerCount(jsi::Runtime &runtime, const jsi::Object &emitter, EventId eventId) {
   if (NativeState::Shared state = NativeState::get(runtime, emitter, false)) {
-    return state->listeners.listenersCount(eventName);
+    return state->listeners.listenersCount(eventId);
   }
   return 0;
 }
 
-jsi::Value createEventSubscription(jsi::Runtime &runtime, const std::string &eventName, const jsi::Object &emitter, const jsi::Function &listener) {
+jsi::Value createEventSubscription(jsi::Runtime &runtime, EventId eventId, const jsi::Object &emitter, const jsi::Function &listener) {
   jsi::Object subscription(runtime);
   jsi::PropNameID removeProp = jsi::PropNameID::forAscii(runtime, "remove", 6);
   std::shared_ptr<jsi::Value> emitterValue = std::make_shared<jsi::Value>(runtime, emitter);
   std::shared_ptr<jsi::Value> listenerValue = std::make_shared<jsi::Value>(runtime, listener);
 
-  jsi::HostFunctionType removeSubscription = [eventName, emitterValue, listenerValue](jsi::Runtime &runtime, const jsi::Value &thisValue, const jsi::Value *args, size_t count) -> jsi::Value {
+  jsi::HostFunctionType removeSubscription = [eventId, emitterValue, listenerValue](jsi::Runtime &runtime, const jsi::Value &thisValue, const jsi::Value *args, size_t count) -> jsi::Value {
     jsi::Object emitter = emitterValue->getObject(runtime);
     jsi::Function listener = listenerValue->getObject(runtime).getFunction(runtime);
 
-    removeListener(runtime, emitter, eventName, listener);
+    removeListener(runtime, emitter, eventId, listener);
     return jsi::Value::undefined();
   };
 
@@ -200,10 +303,73 @@ jsi::Value createEventSubscription(jsi::Runtime &runtime, const std::string &eve
   return jsi::Value(runtime, subscription);
 }
 
+namespace {
+
+/**
+ Event IDs of the names recently passed to the `EventEmitter` methods, cached per runtime.
+ The JS strings are compared with `strictEquals`, so calls with one of these names
+ don't need to convert it to UTF-8 and look it up in the global table.
+ */
+class EventIdsCache {
+public:
+  static constexpr jsi::UUID uuid{0xc50b7ca3, 0x9319, 0x47c5, 0xb84a, 0xd1a3d3ab6b4d};
+
+  explicit EventIdsCache(jsi::Runtime &runtime) {}
+
+  EventId get(jsi::Runtime &runtime, const jsi::String &eventName) {
+    for (const auto &entry : entries) {
+      if (jsi::String::strictEquals(runtime, entry.eventName, eventName)) {
+        return entry.eventId;
+      }
+    }
+    EventId eventId = internEventName(eventName.utf8(runtime));
+    Entry entry{jsi::Value(runtime, eventName).getString(runtime), eventId};
+
+    if (entries.size() < capacity) {
+      entries.push_back(std::move(entry));
+    } else {
+      // Replaces the entries in a round-robin fashion.
+      entries[nextReplacedEntry] = std::move(entry);
+      nextReplacedEntry = (nextReplacedEntry + 1) % capacity;
+    }
+    return eventId;
+  }
+
+private:
+  static constexpr size_t capacity = 16;
+
+  struct Entry {
+    jsi::String eventName;
+    EventId eventId;
+  };
+
+  std::vector<Entry> entries;
+  size_t nextReplacedEntry = 0;
+};
+
+} // namespace
+
+/**
+ Returns the ID of the event name passed as the first argument to the `EventEmitter` methods.
+ */
+inline EventId eventIdFromArgument(jsi::Runtime &runtime, const jsi::Value &argument) {
+  return common::getRuntimeCache<EventIdsCache>(runtime).get(runtime, argument.asString(runtime));
+}
+
 #pragma mark - Public API
 
+void emitEvent(jsi::Runtime &runtime, const jsi::Object &emitter, EventId eventId, const jsi::Value *args, size_t count) {
+  if (NativeState::Shared state = NativeState::get(runtime, emitter, false)) {
+    state->listeners.call(runtime, eventId, emitter, args, count);
+  }
+}
+
+void emitEvent(jsi::Runtime &runtime, const jsi::Object &emitter, const std::string &eventName, const jsi::Value *args, size_t count) {
+  emitEvent(runtime, emitter, internEventName(eventName), args, count);
+}
+
 void emitEvent(jsi::Runtime &runtime, const jsi::Object &emitter, const std::string &eventName, const std::vector<jsi::Value> &arguments) {
-  emitEvent(runtime, emitter, eventName, arguments.data(), arguments.size());
+  emitEvent(runtime, emitter, internEventName(eventName), arguments.data(), arguments.size());
 }
 
 jsi::Function getClass(jsi::Runtime &runtime) {
@@ -233,7 +399,7 @@ void installClass(jsi::Runtime &runtime) {
   jsi::Object prototype = eventEmitterClass.getPropertyAsObject(runtime, "prototype");
 
   jsi::HostFunctionType addListenerHost = [](jsi::Runtime &runtime, const jsi::Value &thisValue, const jsi::Value *args, size_t count) -> jsi::Value {
-    std::string eventName = args[0].asString(runtime).utf8(runtime);
+    EventId eventId = eventIdFromArgument(runtime, args[0]);
     jsi::Function listener = args[1].asObject(runtime).asFunction(runtime);
     jsi::Object thisObject = thisValue.getObject(runtime);
 
@@ -241,35 +407,35 @@ void installClass(jsi::Runtime &runtime) {
     // For native modules we need to unwrap it to get the object used under the hood by `LazyObject` host object.
     const jsi::Object &emitter = LazyObject::unwrapObjectIfNecessary(runtime, thisObject);
 
-    addListener(runtime, emitter, eventName, listener);
-    return createEventSubscription(runtime, eventName, emitter, listener);
+    addListener(runtime, emitter, eventId, listener);
+    return createEventSubscription(runtime, eventId, emitter, listener);
   };
 
   jsi::HostFunctionType removeListenerHost = [](jsi::Runtime &runtime, const jsi::Value &thisValue, const jsi::Value *args, size_t count) -> jsi::Value {
-    std::string eventName = args[0].asString(runtime).utf8(runtime);
+    EventId eventId = eventIdFromArgument(runtime, args[0]);
     jsi::Function listener = args[1].asObject(runtime).asFunction(runtime);
     jsi::Object thisObject = thisValue.getObject(runtime);
 
     // Unwrap `this` object if it's a lazy object (e.g. native module).
     const jsi::Object &emitter = LazyObject::unwrapObjectIfNecessary(runtime, thisObject);
 
-    removeListener(runtime, emitter, eventName, listener);
+    removeListener(runtime, emitter, eventId, listener);
     return jsi::Value::undefined();
   };
 
   jsi::HostFunctionType removeAllListenersHost = [](jsi::Runtime &runtime, const jsi::Value &thisValue, const jsi::Value *args, size_t count) -> jsi::Value {
-    std::string eventName = args[0].asString(runtime).utf8(runtime);
+    EventId eventId = eventIdFromArgument(runtime, args[0]);
     jsi::Object thisObject = thisValue.getObject(runtime);
 
     // Unwrap `this` object if it's a lazy object (e.g. native module).
     const jsi::Object &emitter = LazyObject::unwrapObjectIfNecessary(runtime, thisObject);
 
-    removeAllListeners(runtime, emitter, eventName);
+    removeAllListeners(runtime, emitter, eventId);
     return jsi::Value::undefined();
   };
 
   jsi::HostFunctionType emit = [](jsi::Runtime &runtime, const jsi::Value &thisValue, const jsi::Value *args, size_t count) -> jsi::Value {
-    std::string eventName = args[0].asString(runtime).utf8(runtime);
+    EventId eventId = eventIdFromArgument(runtime, args[0]);
     jsi::Object thisObject = thisValue.getObject(runtime);
 
     // Unwrap `this` object if it's a lazy object (e.g. native module).
@@ -278,18 +444,18 @@ void installClass(jsi::Runtime &runtime) {
     // Make a new pointer that skips the first argument which is the event name.
     const jsi::Value *eventArgs = count > 1 ? &args[1] : nullptr;
 
-    emitEvent(runtime, emitter, eventName, eventArgs, count - 1);
+    emitEvent(runtime, emitter, eventId, eventArgs, count - 1);
     return jsi::Value::undefined();
   };
 
   jsi::HostFunctionType listenerCountHost = [](jsi::Runtime &runtime, const jsi::Value &thisValue, const jsi::Value *args, size_t count) -> jsi::Value {
-    std::string eventName = args[0].asString(runtime).utf8(runtime);
+    EventId eventId = eventIdFromArgument(runtime, args[0]);
     jsi::Object thisObject = thisValue.getObject(runtime);
 
     // Unwrap `this` object if it's a lazy object (e.g. native module).
     const jsi::Object &emitter = LazyObject::unwrapObjectIfNecessary(runtime, thisObject);
 
-    return jsi::Value((int)getListenerCount(runtime, emitter, eventName));
+    return jsi::Value((int)getListenerCount(runtime, emitter, eventId));
   };
 
   // Added for compatibility with the old EventEmitter API.
@@ -2,8 +2,8 @@
 
 #ifdef __cplusplus
 
-#include <unordered_map>
-#include <list>
+#include <string>
+#include <vector>
 #include <jsi/jsi.h>
 
 // Apple ships ExpoModulesJSI; non-Apple platforms (Android) don't, so the
@@ -17,62 +17,115 @@ namespace jsi = facebook::jsi;
 
 namespace expo::EventEmitter {
 
+/**
+ Type of the interned event name IDs.
+ */
+typedef uint32_t EventId;
+
+/**
+ Returns an ID uniquely identifying the given event name, registering the name if it's seen for the first time.
+ The table is process-wide and shared by all runtimes, so native code can intern its event names once
+ and emit by the ID afterwards. Thread-safe.
+ */
+EventId internEventName(const std::string &eventName);
+
+/**
+ Returns the event name for the ID obtained from `internEventName`. Thread-safe.
+ */
+const std::string &getEventName(EventId eventId);
+
 /**
  Class containing and managing listeners of the event emitter.
  */
 class Listeners {
 private:
   friend class NativeState;
-  friend void addListener(jsi::Runtime &runtime, const jsi::Object &emitter, const std::string &eventName, const jsi::Function &listener);
-  friend void removeListener(jsi::Runtime &runtime, const jsi::Object &emitter, const std::string &eventName, const jsi::Function &listener);
-  friend void removeAllListeners(jsi::Runtime &runtime, const jsi::Object &emitter, const std::string &eventName);
-  friend void emitEvent(jsi::Runtime &runtime, const jsi::Object &emitter, const std::string &eventName, const jsi::Value *args, size_t count);
-  friend size_t getListenerCount(jsi::Runtime &runtime, const jsi::Object &emitter, const std::string &eventName);
+  friend void addListener(jsi::Runtime &runtime, const jsi::Object &emitter, EventId eventId, const jsi::Function &listener);
+  friend void removeListener(jsi::Runtime &runtime, const jsi::Object &emitter, EventId eventId, const jsi::Function &listener);
+  friend void removeAllListeners(jsi::Runtime &runtime, const jsi::Object &emitter, EventId eventId);
+  friend void emitEvent(jsi::Runtime &runtime, const jsi::Object &emitter, EventId eventId, const jsi::Value *args, size_t count);
+  friend size_t getListenerCount(jsi::Runtime &runtime, const jsi::Object &emitter, EventId eventId);
 
   /**
-   Type of the list containing listeners for the specific event name.
+   A single listener entry. Listeners removed during the emission are only marked as removed
+   and get erased once the outermost emission of that event finishes.
    */
-  using ListenersList = std::list<jsi::Value>;
+  struct Listener {
+    jsi::Function function;
+    bool removed = false;
+  };
 
   /**
-   Type of the map where the keys are event names and the values are lists of listeners.
+   Listeners registered for the specific event.
    */
-  using ListenersMap = std::unordered_map<std::string, ListenersList>;
+  struct EventListeners {
+    EventId eventId;
+
+    /**
+     Listeners in the order they were added. This vector is never resized while the event is being emitted.
+     */
+    std::vector<Listener> listeners;
+
+    /**
+     Listeners added while the event was being emitted. They are moved to `listeners` when the emission finishes.
+     */
+    std::vector<Listener> pending;
+
+    /**
+     Number of listeners that were not removed.
+     */
+    size_t count = 0;
+
+    /**
+     Depth of the nested emissions of this event, zero when the event is not being emitted.
+     */
+    size_t emitDepth = 0;
+  };
 
   /**
-   Map with the events and listeners.
+   Listeners grouped by the event. Emitters usually have just a few events, so the linear lookup is faster than hashing.
    */
-  ListenersMap listenersMap;
+  std::vector<EventListeners> events;
 
   /**
-   Adds a listener for the given event name.
+   Finds listeners for the given event ID. Returns `nullptr` when there are none.
    */
-  void add(jsi::Runtime &runtime, const std::string& eventName, const jsi::Function &listener) noexcept;
+  EventListeners *find(EventId eventId) noexcept;
 
   /**
-   Removes the listener for the given event name.
+   Erases listeners marked as removed and moves pending listeners once the emission has finished.
    */
-  void remove(jsi::Runtime &runtime, const std::string& eventName, const jsi::Function &listener) noexcept;
+  static void flush(EventListeners &eventListeners) noexcept;
 
   /**
-   Removes all listeners for the given event name.
+   Adds a listener for the given event ID.
    */
-  void removeAll(const std::string& eventName) noexcept;
+  void add(jsi::Runtime &runtime, EventId eventId, const jsi::Function &listener) noexcept;
 
   /**
-   Clears the entire map of events and listeners.
+   Removes the listener for the given event ID.
+   */
+  void remove(jsi::Runtime &runtime, EventId eventId, const jsi::Function &listener) noexcept;
+
+  /**
+   Removes all listeners for the given event ID.
+   */
+  void removeAll(EventId eventId) noexcept;
+
+  /**
+   Clears all events and listeners. During an emission, listeners are only marked as removed like in `removeAll`.
    */
   void clear() noexcept;
 
   /**
-   Returns a number of listeners added for the given event name.
+   Returns a number of listeners added for the given event ID.
    */
-  size_t listenersCount(const std::string& eventName) noexcept;
+  size_t listenersCount(EventId eventId) noexcept;
 
   /**
-   Calls listeners for the given event name, with the given `this` object and payload arguments.
+   Calls listeners for the given event ID, with the given `this` object and payload arguments.
    */
-  void call(jsi::Runtime &runtime, const std::string& eventName, const jsi::Object &thisObject, const jsi::Value *args, size_t count) noexcept;
+  void call(jsi::Runtime &runtime, EventId eventId, const jsi::Object &thisObject, const jsi::Value *args, size_t count) noexcept;
 };
 
 // Apple platforms ship `expo::NativeState`, which carries an opaque context pointer
@@ -123,6 +176,12 @@ void emitEvent(jsi::Runtime &runtime, const jsi::Object &emitter, const std::str
  */
 void emitEvent(jsi::Runtime &runtime, const jsi::Object &emitter, const std::string &eventName, const jsi::Value *args, size_t count);
 
+/**
+ Emits an event with the given interned event ID. Prefer this one on hot paths,
+ as it doesn't need to hash the event name nor allocate.
+ */
+void emitEvent(jsi::Runtime &runtime, const jsi::Object &emitter, EventId eventId, const jsi::Value *args, size_t count);
+
 /**
  Gets `expo.EventEmitter` class from the given runtime.
  */
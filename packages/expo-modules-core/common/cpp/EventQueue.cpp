@@ -0,0 +1,236 @@
+// Copyright 2026-present 650 Industries. All rights reserved.
+
+#include "EventQueue.h"
+
+#include <condition_variable>
+#include <map>
+#include <thread>
+
+namespace expo::EventEmitter {
+
+namespace {
+
+/**
+ A single thread that runs tasks at given times, shared by all queues. It's started on first use and never stopped.
+ The tasks must be short, they're only supposed to move events to the queue and schedule its drain.
+ */
+class DelayedTasksRunner {
+public:
+  using Clock = std::chrono::steady_clock;
+
+  static DelayedTasksRunner &shared() {
+    // Never destroyed, as the thread is detached and may still be waiting for tasks.
+    static auto *runner = new DelayedTasksRunner();
+    return *runner;
+  }
+
+  void schedule(Clock::time_point deadline, std::function<void()> &&task) {
+    std::lock_guard lock(mutex);
+    tasks.emplace(deadline, std::move(task));
+
+    if (!isStarted) {
+      isStarted = true;
+      std::thread([this]() { run(); }).detach();
+    }
+    condition.notify_one();
+  }
+
+private:
+  std::mutex mutex;
+  std::condition_variable condition;
+  std::multimap<Clock::time_point, std::function<void()>> tasks;
+  bool isStarted = false;
+
+  [[noreturn]] void run() {
+    std::unique_lock lock(mutex);
+
+    while (true) {
+      if (tasks.empty()) {
+        condition.wait(lock);
+        continue;
+      }
+      auto deadline = tasks.begin()->first;
+
+      if (Clock::now() < deadline) {
+        condition.wait_until(lock, deadline);
+        continue;
+      }
+      auto task = std::move(tasks.begin()->second);
+      tasks.erase(tasks.begin());
+
+      lock.unlock();
+      task();
+      lock.lock();
+    }
+  }
+};
+
+} // namespace
+
+EventQueue::EventQueue(Scheduler scheduler) : scheduler(std::move(scheduler)) {}
+
+void EventQueue::setPolicy(const void *target, EventId eventId, DeliveryPolicy policy) {
+  std::lock_guard lock(mutex);
+  policies[CoalescingKey { target, eventId }] = policy;
+}
+
+DeliveryPolicy EventQueue::getPolicy(const void *target, EventId eventId) const {
+  if (auto policy = policies.find(CoalescingKey { target, eventId }); policy != policies.end()) {
+    return policy->second;
+  }
+  if (auto policy = policies.find(CoalescingKey { nullptr, eventId }); policy != policies.end()) {
+    return policy->second;
+  }
+  return DeliveryPolicy {};
+}
+
+void EventQueue::forgetTarget(const void *target) {
+  std::erase_if(samples, [target](const auto &sample) {
+    return sample.first.target == target;
+  });
+  std::erase_if(policies, [target](const auto &policy) {
+    return policy.first.target == target;
+  });
+}
+
+void EventQueue::enqueue(const void *target, EventId eventId, TargetProvider targetProvider, ArgsProvider argsProvider) {
+  bool shouldScheduleDrain = false;
+  {
+    std::lock_guard lock(mutex);
+
+    if (!isValid) {
+      return;
+    }
+
+    DeliveryPolicy policy = getPolicy(target, eventId);
+    Event event { target, eventId, std::move(targetProvider), std::move(argsProvider) };
+
+    if (policy.mode == DeliveryPolicy::Mode::Sample) {
+      CoalescingKey key { target, eventId };
+      auto now = std::chrono::steady_clock::now();
+      auto [sample, inserted] = samples.try_emplace(key, std::nullopt);
+
+      if (!inserted) {
+        // Too soon after the last sample, hold the event back until the interval elapses.
+        // The timer is already scheduled, it was scheduled with the last sample.
+        sample->second = std::move(event);
+        return;
+      }
+      scheduleSampleTimer(key, now + policy.sampleInterval);
+    }
+
+    shouldScheduleDrain = pushEvent(std::move(event), policy.mode);
+  }
+
+  if (shouldScheduleDrain) {
+    scheduleDrain();
+  }
+}
+
+bool EventQueue::pushEvent(Event &&event, DeliveryPolicy::Mode mode) {
+  if (mode == DeliveryPolicy::Mode::All) {
+    events.push_back(std::move(event));
+  } else {
+    auto [position, inserted] = coalescableEvents.try_emplace(CoalescingKey { event.target, event.eventId }, events.size());
+
+    if (inserted) {
+      events.push_back(std::move(event));
+    } else {
+      // Replace the payload of the already queued event, so it keeps its position in the queue.
+      events[position->second].argsProvider = std::move(event.argsProvider);
+    }
+  }
+
+  if (isDrainScheduled) {
+    return false;
+  }
+  isDrainScheduled = true;
+  return true;
+}
+
+void EventQueue::scheduleSampleTimer(const CoalescingKey &key, std::chrono::steady_clock::time_point deadline) {
+  DelayedTasksRunner::shared().schedule(deadline, [weakThis = weak_from_this(), key]() {
+    if (auto self = weakThis.lock()) {
+      self->onSampleIntervalElapsed(key);
+    }
+  });
+}
+
+void EventQueue::onSampleIntervalElapsed(const CoalescingKey &key) {
+  bool shouldScheduleDrain = false;
+  {
+    std::lock_guard lock(mutex);
+
+    auto sample = samples.find(key);
+    if (!isValid || sample == samples.end()) {
+      return;
+    }
+    if (!sample->second) {
+      // Nothing was emitted during the interval, so the next event can be delivered right away.
+      samples.erase(sample);
+      return;
+    }
+
+    // Deliver the trailing event as a new sample and start the next interval.
+    auto interval = getPolicy(key.target, key.eventId).sampleInterval;
+    auto now = std::chrono::steady_clock::now();
+    Event event = std::move(*sample->second);
+
+    sample->second.reset();
+    scheduleSampleTimer(key, now + interval);
+
+    shouldScheduleDrain = pushEvent(std::move(event), DeliveryPolicy::Mode::Sample);
+  }
+
+  if (shouldScheduleDrain) {
+    scheduleDrain();
+  }
+}
+
+void EventQueue::scheduleDrain() {
+  scheduler([weakThis = weak_from_this()](jsi::Runtime &runtime) {
+    if (auto self = weakThis.lock()) {
+      self->drain(runtime);
+    }
+  });
+}
+
+void EventQueue::drain(jsi::Runtime &runtime) {
+  {
+    std::lock_guard lock(mutex);
+    std::swap(events, drainingEvents);
+    coalescableEvents.clear();
+    isDrainScheduled = false;
+  }
+
+  try {
+    for (Event &event : drainingEvents) {
+      std::optional<jsi::Object> target = event.targetProvider(runtime);
+
+      if (!target) {
+        // The JS object was deallocated - we can ignore emitting an event and forget its samples and policies.
+        std::lock_guard lock(mutex);
+        forgetTarget(event.target);
+        continue;
+      }
+
+      std::vector<jsi::Value> args = event.argsProvider(runtime);
+      emitEvent(runtime, *target, event.eventId, args.data(), args.size());
+    }
+  } catch (...) {
+    // Don't let the remaining events leak into the next drain.
+    drainingEvents.clear();
+    throw;
+  }
+  drainingEvents.clear();
+}
+
+void EventQueue::invalidate() noexcept {
+  std::lock_guard lock(mutex);
+  isValid = false;
+  events.clear();
+  coalescableEvents.clear();
+  samples.clear();
+}
+
+} // namespace expo::EventEmitter
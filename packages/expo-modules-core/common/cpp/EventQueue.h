@@ -0,0 +1,186 @@
+// Copyright 2026-present 650 Industries. All rights reserved.
+
+#pragma once
+
+#ifdef __cplusplus
+
+#include <chrono>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+#include <jsi/jsi.h>
+
+#include "EventEmitter.h"
+
+namespace jsi = facebook::jsi;
+
+namespace expo::EventEmitter {
+
+/**
+ Describes how the queue delivers events with the same name emitted to the same object within a single drain.
+ */
+struct DeliveryPolicy {
+  enum class Mode {
+    /**
+     Every event is delivered, in the order they were emitted.
+     */
+    All = 0,
+    /**
+     Only the latest event is delivered. It takes the place of the first queued one.
+     */
+    Latest = 1,
+    /**
+     Same as `Latest`, but at most one event is delivered per `sampleInterval`. Events emitted sooner than that
+     after the last delivered one are held back and only the last of them is delivered once the interval elapses,
+     so listeners always end up with the latest value.
+     */
+    Sample = 2,
+  };
+
+  Mode mode = Mode::All;
+  std::chrono::milliseconds sampleInterval{0};
+};
+
+/**
+ A queue that collects events emitted from any thread and delivers them to JS listeners in batches.
+ Instead of scheduling a separate JS task for every event, the queue schedules one drain
+ for all events that were enqueued until the drain runs.
+
+ Ordering: the drain is scheduled with the scheduler when the first event is enqueued after the previous drain.
+ It runs after the JS tasks that were already scheduled at that time, and events enqueued until then are delivered in that
+ single task, in the order they were enqueued (a coalesced event keeps the position of the first one it replaced).
+ Microtasks, e.g. promise reactions, scheduled by the listeners run after the whole batch. Other queues, like the one
+ settling promises, schedule their own tasks, so an event and a promise settlement are only ordered by their tasks.
+ Held back `Sample` events are enqueued once their interval elapses, so they're delivered with a later batch.
+ */
+class EventQueue : public std::enable_shared_from_this<EventQueue> {
+public:
+  using Shared = std::shared_ptr<EventQueue>;
+
+  /**
+   Returns the object the event should be emitted to or `std::nullopt` when it no longer exists.
+   */
+  using TargetProvider = std::function<std::optional<jsi::Object>(jsi::Runtime &runtime)>;
+
+  /**
+   Creates the event arguments. It's invoked on the JS thread right before the event is delivered.
+   */
+  using ArgsProvider = std::function<std::vector<jsi::Value>(jsi::Runtime &runtime)>;
+
+  /**
+   Schedules the given task on the JS thread.
+   */
+  using Scheduler = std::function<void(std::function<void(jsi::Runtime &runtime)> &&task)>;
+
+  explicit EventQueue(Scheduler scheduler);
+
+  /**
+   Sets the delivery policy for events with the given name emitted to the given target. Thread-safe.
+   When `target` is a null pointer, the policy applies to all targets that don't have their own policy for this event.
+   Policies of a target are removed once the queue finds out that its JS object no longer exists.
+   */
+  void setPolicy(const void *target, EventId eventId, DeliveryPolicy policy);
+
+  /**
+   Adds an event to the queue and schedules a drain unless one is already scheduled. Thread-safe.
+   The `target` pointer only identifies the emitter object when coalescing events, it's never dereferenced.
+   */
+  void enqueue(const void *target, EventId eventId, TargetProvider targetProvider, ArgsProvider argsProvider);
+
+  /**
+   Delivers all queued events. Must be called on the JS thread.
+   */
+  void drain(jsi::Runtime &runtime);
+
+  /**
+   Drops queued events. Events enqueued after this call are ignored.
+   */
+  void invalidate() noexcept;
+
+private:
+  struct Event {
+    const void *target;
+    EventId eventId;
+    TargetProvider targetProvider;
+    ArgsProvider argsProvider;
+  };
+
+  struct CoalescingKey {
+    const void *target;
+    EventId eventId;
+
+    bool operator==(const CoalescingKey &other) const = default;
+  };
+
+  struct CoalescingKeyHash {
+    size_t operator()(const CoalescingKey &key) const noexcept {
+      return std::hash<const void *>()(key.target) ^ (std::hash<EventId>()(key.eventId) << 1);
+    }
+  };
+
+  std::mutex mutex;
+  Scheduler scheduler;
+  bool isDrainScheduled = false;
+  bool isValid = true;
+
+  /**
+   Events waiting for the next drain.
+   */
+  std::vector<Event> events;
+
+  /**
+   Events that are being delivered. Only accessed on the JS thread; swapped with `events` so both keep their capacity.
+   */
+  std::vector<Event> drainingEvents;
+
+  /**
+   Positions in `events` of the events that can be replaced by a newer one.
+   */
+  std::unordered_map<CoalescingKey, size_t, CoalescingKeyHash> coalescableEvents;
+
+  /**
+   Events delivered with the `Sample` policy whose sample interval hasn't elapsed yet, with the latest event
+   emitted during the interval (if any), enqueued once the interval elapses. An entry is removed when its interval
+   elapses without any new event, or when its emitter turns out to be gone, so it doesn't outlive the emitter.
+   */
+  std::unordered_map<CoalescingKey, std::optional<Event>, CoalescingKeyHash> samples;
+
+  /**
+   Delivery policies keyed by the target and event. Keys with a null target hold the defaults for all targets.
+   */
+  std::unordered_map<CoalescingKey, DeliveryPolicy, CoalescingKeyHash> policies;
+
+  /**
+   Returns the policy for the given target and event. Requires the mutex to be locked.
+   */
+  DeliveryPolicy getPolicy(const void *target, EventId eventId) const;
+
+  /**
+   Forgets the samples and policies of the target whose JS object no longer exists. Requires the mutex to be locked.
+   */
+  void forgetTarget(const void *target);
+
+  /**
+   Adds the event to `events`, replacing the queued event for the same target and name unless the mode is `All`.
+   Requires the mutex to be locked. Returns whether the drain needs to be scheduled.
+   */
+  bool pushEvent(Event &&event, DeliveryPolicy::Mode mode);
+
+  /**
+   Schedules `onSampleIntervalElapsed` for the given key after the interval.
+   */
+  void scheduleSampleTimer(const CoalescingKey &key, std::chrono::steady_clock::time_point deadline);
+
+  /**
+   Enqueues the trailing event of the sample with the given key or removes the sample when there is none.
+   */
+  void onSampleIntervalElapsed(const CoalescingKey &key);
+
+  void scheduleDrain();
+}; // class EventQueue
+
+} // namespace expo::EventEmitter
+
+#endif // __cplusplus
@@ -6,69 +6,140 @@
 
 namespace expo::common {
 
+namespace {
+
+/**
+ The name of the prototype property holding the native constructor.
+ */
+constexpr char nativeConstructorKey[] = "__native_constructor__";
+
+/**
+ Per-runtime factory of the JS classes. Evaluates the constructor template once,
+ so creating a class doesn't need to parse and compile any JavaScript code.
+ */
+struct ClassFactory {
+  static constexpr jsi::UUID uuid{0x42c2dc75, 0x1507, 0x402e, 0x968a, 0xb4704afa6ca9};
+
+  /**
+   JS function with the `(name, nativeConstructor, basePrototype)` parameters, that returns a new class.
+   */
+  jsi::Function factory;
+
+  explicit ClassFactory(jsi::Runtime &runtime) : factory(compile(runtime)) {}
+
+  static jsi::Function compile(jsi::Runtime &runtime) {
+    std::stringstream source;
+    source
+      << "(function createClass(name, nativeConstructor, basePrototype) {"
+      << "  const klass = function (...args) { return this." << nativeConstructorKey << "(...args); };"
+      << "  Object.defineProperty(klass, 'name', { value: name });"
+      << "  Object.defineProperty(klass.prototype, '" << nativeConstructorKey << "', { value: nativeConstructor });"
+      << "  if (basePrototype) {"
+      << "    Object.setPrototypeOf(klass.prototype, basePrototype);"
+      << "  }"
+      << "  return klass;"
+      << "})";
+    std::shared_ptr<jsi::StringBuffer> sourceBuffer = std::make_shared<jsi::StringBuffer>(source.str());
+
+    return runtime
+      .evaluateJavaScript(sourceBuffer, "expo-modules-core/createClass")
+      .asObject(runtime)
+      .asFunction(runtime);
+  }
+
+  jsi::Function createClass(jsi::Runtime &runtime, const char *name, ClassConstructor constructor, jsi::Value basePrototype) {
+    jsi::PropNameID nativeConstructorPropId = jsi::PropNameID::forAscii(runtime, nativeConstructorKey);
+    jsi::Function nativeConstructor = jsi::Function::createFromHostFunction(
+      runtime,
+      nativeConstructorPropId,
+      // The paramCount is not obligatory to match, it only affects the `length` property of the function.
+      0,
+      [constructor = std::move(constructor)](jsi::Runtime &runtime, const jsi::Value &thisValue, const jsi::Value *args, size_t count) -> jsi::Value {
+        if (constructor) {
+          return constructor(runtime, thisValue, args, count);
+        }
+        return jsi::Value(runtime, thisValue);
+      });
+
+    return factory
+      .call(runtime, {
+        jsi::String::createFromUtf8(runtime, name),
+        std::move(nativeConstructor),
+        std::move(basePrototype)
+      })
+      .asObject(runtime)
+      .asFunction(runtime);
+  }
+}; // struct ClassFactory
+
+/**
+ Per-runtime cache of the `Object` functions and property names used to define properties,
+ so they are not looked up in the global object on every call.
+ */
+struct ObjectFunctions {
+  static constexpr jsi::UUID uuid{0xa56a86b8, 0xe988, 0x4cbd, 0xaca0, 0x94f21f0b868c};
+
+  jsi::Object objectClass;
+  jsi::Function create;
+  jsi::Function defineProperty;
+  jsi::Function defineProperties;
+
+  jsi::PropNameID configurablePropName;
+  jsi::PropNameID enumerablePropName;
+  jsi::PropNameID writablePropName;
+  jsi::PropNameID valuePropName;
+  jsi::PropNameID getPropName;
+  jsi::PropNameID setPropName;
+
+  explicit ObjectFunctions(jsi::Runtime &runtime)
+    : objectClass(runtime.global().getPropertyAsObject(runtime, "Object")),
+      create(objectClass.getPropertyAsFunction(runtime, "create")),
+      defineProperty(objectClass.getPropertyAsFunction(runtime, "defineProperty")),
+      defineProperties(objectClass.getPropertyAsFunction(runtime, "defineProperties")),
+      configurablePropName(jsi::PropNameID::forAscii(runtime, "configurable", 12)),
+      enumerablePropName(jsi::PropNameID::forAscii(runtime, "enumerable", 10)),
+      writablePropName(jsi::PropNameID::forAscii(runtime, "writable", 8)),
+      valuePropName(jsi::PropNameID::forAscii(runtime, "value", 5)),
+      getPropName(jsi::PropNameID::forAscii(runtime, "get", 3)),
+      setPropName(jsi::PropNameID::forAscii(runtime, "set", 3)) {}
+}; // struct ObjectFunctions
+
+} // namespace
+
 jsi::Function createClass(jsi::Runtime &runtime, const char *name, ClassConstructor constructor) {
-  std::string nativeConstructorKey("__native_constructor__");
-
-  // Create a string buffer of the source code to evaluate.
-  std::stringstream source;
-  source << "(function " << name << "(...args) { return this." << nativeConstructorKey << "(...args); })";
-  std::shared_ptr<jsi::StringBuffer> sourceBuffer = std::make_shared<jsi::StringBuffer>(source.str());
-
-  // Evaluate the code and obtain the returned value (the constructor function).
-  jsi::Object klass = runtime.evaluateJavaScript(sourceBuffer, "").asObject(runtime);
-
-  // Set the native constructor in the prototype.
-  jsi::Object prototype = klass.getPropertyAsObject(runtime, "prototype");
-  jsi::PropNameID nativeConstructorPropId = jsi::PropNameID::forAscii(runtime, nativeConstructorKey);
-  jsi::Function nativeConstructor = jsi::Function::createFromHostFunction(
-    runtime,
-    nativeConstructorPropId,
-    // The paramCount is not obligatory to match, it only affects the `length` property of the function.
-    0,
-    [constructor = std::move(constructor)](jsi::Runtime &runtime, const jsi::Value &thisValue, const jsi::Value *args, size_t count) -> jsi::Value {
-      if (constructor) {
-        return constructor(runtime, thisValue, args, count);
-      }
-      return jsi::Value(runtime, thisValue);
-    });
-
-  jsi::Object descriptor(runtime);
-  descriptor.setProperty(runtime, "value", jsi::Value(runtime, nativeConstructor));
-
-  defineProperty(runtime, &prototype, nativeConstructorKey.c_str(), std::move(descriptor));
-
-  return klass.asFunction(runtime);
+  return getRuntimeCache<ClassFactory>(runtime)
+    .createClass(runtime, name, std::move(constructor), jsi::Value::undefined());
 }
 
 jsi::Function createInheritingClass(jsi::Runtime &runtime, const char *className, jsi::Function &baseClass, ClassConstructor constructor) {
   jsi::PropNameID prototypePropNameId = jsi::PropNameID::forAscii(runtime, "prototype", 9);
-  jsi::Object baseClassPrototype = baseClass
-    .getProperty(runtime, prototypePropNameId)
-    .asObject(runtime);
+  jsi::Value baseClassPrototype = baseClass.getProperty(runtime, prototypePropNameId);
 
-  jsi::Function klass = createClass(runtime, className, std::move(constructor));
-  jsi::Object klassPrototype = klass.getProperty(runtime, prototypePropNameId).asObject(runtime);
-
-  klassPrototype.setProperty(runtime, "__proto__", baseClassPrototype);
-
-  return klass;
+  return getRuntimeCache<ClassFactory>(runtime)
+    .createClass(runtime, className, std::move(constructor), std::move(baseClassPrototype));
 }
 
 jsi::Object createObjectWithPrototype(jsi::Runtime &runtime, jsi::Object *prototype) {
-  // Get the "Object" class.
-  jsi::Object objectClass = runtime
-    .global()
-    .getPropertyAsObject(runtime, "Object");
+  ObjectFunctions &objectFunctions = getRuntimeCache<ObjectFunctions>(runtime);
 
   // Call "Object.create(prototype)" to create an object with the given prototype without calling the constructor.
-  jsi::Object object = objectClass
-    .getPropertyAsFunction(runtime, "create")
-    .callWithThis(runtime, objectClass, {
+  return objectFunctions.create
+    .callWithThis(runtime, objectFunctions.objectClass, {
       jsi::Value(runtime, *prototype)
     })
     .asObject(runtime);
+}
 
-  return object;
+jsi::Object createObjectWithPrototype(jsi::Runtime &runtime, jsi::Object *prototype, jsi::Object descriptors) {
+  ObjectFunctions &objectFunctions = getRuntimeCache<ObjectFunctions>(runtime);
+
+  // Call "Object.create(prototype, descriptors)" to define the properties in the same call.
+  return objectFunctions.create
+    .callWithThis(runtime, objectFunctions.objectClass, {
+      jsi::Value(runtime, *prototype),
+      std::move(descriptors)
+    })
+    .asObject(runtime);
 }
 
 std::vector<jsi::PropNameID> jsiArrayToPropNameIdsVector(jsi::Runtime &runtime, const jsi::Array &array) {
@@ -84,64 +155,73 @@ std::vector<jsi::PropNameID> jsiArrayToPropNameIdsVector(jsi::Runtime &runtime,
   return vector;
 }
 
-void defineProperty(jsi::Runtime &runtime, jsi::Object *object, const char *name, const PropertyDescriptor& descriptor) {
+jsi::Object createPropertyDescriptor(jsi::Runtime &runtime, const PropertyDescriptor& descriptor) {
+  ObjectFunctions &objectFunctions = getRuntimeCache<ObjectFunctions>(runtime);
   jsi::Object jsDescriptor(runtime);
 
   // These three flags are all `false` by default, so set the property only when `true`.
   if (descriptor.configurable) {
-    jsDescriptor.setProperty(runtime, "configurable", jsi::Value(true));
+    jsDescriptor.setProperty(runtime, objectFunctions.configurablePropName, jsi::Value(true));
   }
   if (descriptor.enumerable) {
-    jsDescriptor.setProperty(runtime, "enumerable", jsi::Value(true));
+    jsDescriptor.setProperty(runtime, objectFunctions.enumerablePropName, jsi::Value(true));
   }
   if (descriptor.writable) {
-    jsDescriptor.setProperty(runtime, "writable", jsi::Value(true));
+    jsDescriptor.setProperty(runtime, objectFunctions.writablePropName, jsi::Value(true));
   }
 
   if (descriptor.get) {
-    jsi::PropNameID getPropName = jsi::PropNameID::forAscii(runtime, "get", 3);
     jsi::Function get = jsi::Function::createFromHostFunction(
       runtime,
-      getPropName,
+      objectFunctions.getPropName,
       0,
       [getter = descriptor.get](jsi::Runtime &runtime, const jsi::Value &thisValue, const jsi::Value *args, size_t count) -> jsi::Value {
         return getter(runtime, thisValue.asObject(runtime));
       });
 
-    jsDescriptor.setProperty(runtime, getPropName, get);
+    jsDescriptor.setProperty(runtime, objectFunctions.getPropName, get);
   }
   if (descriptor.set) {
-    jsi::PropNameID setPropName = jsi::PropNameID::forAscii(runtime, "set", 3);
     jsi::Function set = jsi::Function::createFromHostFunction(
       runtime,
-      setPropName,
+      objectFunctions.setPropName,
       1,
       [setter = descriptor.set](jsi::Runtime &runtime, const jsi::Value &thisValue, const jsi::Value *args, size_t count) -> jsi::Value {
         setter(runtime, thisValue.asObject(runtime), jsi::Value(runtime, args[0]));
         return jsi::Value::undefined();
       });
 
-    jsDescriptor.setProperty(runtime, setPropName, set);
+    jsDescriptor.setProperty(runtime, objectFunctions.setPropName, set);
   }
   if (!descriptor.value.isUndefined()) {
-    jsi::PropNameID valuePropName = jsi::PropNameID::forAscii(runtime, "value", 5);
-    jsDescriptor.setProperty(runtime, valuePropName, descriptor.value);
+    jsDescriptor.setProperty(runtime, objectFunctions.valuePropName, descriptor.value);
   }
+  return jsDescriptor;
+}
 
-  defineProperty(runtime, object, name, std::move(jsDescriptor));
+void defineProperty(jsi::Runtime &runtime, jsi::Object *object, const char *name, const PropertyDescriptor& descriptor) {
+  defineProperty(runtime, object, name, createPropertyDescriptor(runtime, descriptor));
 }
 
 void defineProperty(jsi::Runtime &runtime, jsi::Object *object, const char *name, jsi::Object descriptor) {
-  jsi::Object global = runtime.global();
-  jsi::Object objectClass = global.getPropertyAsObject(runtime, "Object");
-  jsi::Function definePropertyFunction = objectClass.getPropertyAsFunction(runtime, "defineProperty");
+  ObjectFunctions &objectFunctions = getRuntimeCache<ObjectFunctions>(runtime);
 
   // This call is basically the same as `Object.defineProperty(object, name, descriptor)` in JS
-  definePropertyFunction.callWithThis(runtime, objectClass, {
+  objectFunctions.defineProperty.callWithThis(runtime, objectFunctions.objectClass, {
     jsi::Value(runtime, *object),
     jsi::String::createFromUtf8(runtime, name),
     std::move(descriptor),
   });
 }
 
+void defineProperties(jsi::Runtime &runtime, jsi::Object *object, jsi::Object descriptors) {
+  ObjectFunctions &objectFunctions = getRuntimeCache<ObjectFunctions>(runtime);
+
+  // This call is basically the same as `Object.defineProperties(object, descriptors)` in JS
+  objectFunctions.defineProperties.callWithThis(runtime, objectFunctions.objectClass, {
+    jsi::Value(runtime, *object),
+    std::move(descriptors),
+  });
+}
+
 } // namespace expo::common
@@ -18,6 +18,22 @@ inline jsi::Object getCoreObject(jsi::Runtime &runtime) {
   return runtime.global().getPropertyAsObject(runtime, "expo");
 }
 
+/**
+ Returns the instance of `T` bound to the given runtime, creating it on first access.
+ `T` must declare a static `jsi::UUID uuid` and a constructor taking the runtime.
+ The instance is destroyed together with the runtime, so it can safely hold JSI values.
+ */
+template <typename T>
+T &getRuntimeCache(jsi::Runtime &runtime) {
+  std::shared_ptr<void> data = runtime.getRuntimeData(T::uuid);
+
+  if (!data) {
+    data = std::make_shared<T>(runtime);
+    runtime.setRuntimeData(T::uuid, data);
+  }
+  return *std::static_pointer_cast<T>(data);
+}
+
 #pragma mark - Classes
 
 /**
@@ -27,6 +43,7 @@ typedef std::function<jsi::Value(jsi::Runtime &runtime, const jsi::Value &thisVa
 
 /**
  Creates a class with the given name and native constructor.
+ The constructor template is compiled only once per runtime, then each class is stamped out from it with a single call.
  */
 jsi::Function createClass(jsi::Runtime &runtime, const char *name, ClassConstructor constructor = nullptr);
 
@@ -40,6 +57,12 @@ jsi::Function createInheritingClass(jsi::Runtime &runtime, const char *className
  */
 jsi::Object createObjectWithPrototype(jsi::Runtime &runtime, jsi::Object *prototype);
 
+/**
+ Creates an object from the given prototype and defines the properties from `descriptors` on it,
+ like `Object.create(prototype, descriptors)` in JS. It's a single call into JS, instead of one more per property.
+ */
+jsi::Object createObjectWithPrototype(jsi::Runtime &runtime, jsi::Object *prototype, jsi::Object descriptors);
+
 #pragma mark - Conversions
 
 /**
@@ -61,6 +84,11 @@ struct PropertyDescriptor {
   const std::function<void(jsi::Runtime &runtime, jsi::Object thisObject, jsi::Value newValue)> set = 0;
 }; // PropertyDescriptor
 
+/**
+ Creates a JS descriptor object from the provided descriptor options.
+ */
+jsi::Object createPropertyDescriptor(jsi::Runtime &runtime, const PropertyDescriptor& descriptor);
+
 /**
  Defines the property on the object with the provided descriptor options.
  */
@@ -71,6 +99,12 @@ void defineProperty(jsi::Runtime &runtime, jsi::Object *object, const char *name
  */
 void defineProperty(jsi::Runtime &runtime, jsi::Object *object, const char *name, jsi::Object descriptor);
 
+/**
+ Calls `Object.defineProperties(object, descriptors)`, where `descriptors` maps property names to their descriptors.
+ Prefer it over `defineProperty` when defining many properties, as it needs only one call into JS.
+ */
+void defineProperties(jsi::Runtime &runtime, jsi::Object *object, jsi::Object descriptors);
+
 } // namespace expo::common
 
 #endif // __cplusplus
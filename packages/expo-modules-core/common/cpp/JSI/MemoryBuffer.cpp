@@ -1,5 +1,7 @@
 #include "MemoryBuffer.h"
 
+#include <bit>
+
 namespace expo {
 
 using namespace facebook;
@@ -21,4 +23,94 @@ size_t MemoryBuffer::size() const {
   return size_;
 }
 
+std::shared_ptr<MemoryBuffer> MemoryBuffer::allocate(size_t size) {
+  size_t capacity;
+  uint8_t *block = MemoryBufferPool::shared().acquire(size, capacity);
+
+  return std::make_shared<MemoryBuffer>(block, size, [block, capacity]() {
+    MemoryBufferPool::shared().release(block, capacity);
+  });
+}
+
+#pragma mark - MemoryBufferPool
+
+MemoryBufferPool &MemoryBufferPool::shared() {
+  // Never destroyed, as buffers can be released during static deinitialization.
+  static auto *pool = new MemoryBufferPool();
+  return *pool;
+}
+
+MemoryBufferPool::~MemoryBufferPool() {
+  trim();
+}
+
+uint8_t *MemoryBufferPool::acquire(size_t size, size_t &capacity) {
+  size_t shift = std::max<size_t>(std::bit_width(std::max<size_t>(size, 1) - 1), minSizeClassShift);
+
+  if (shift > maxSizeClassShift) {
+    misses.fetch_add(1, std::memory_order_relaxed);
+    capacity = size;
+    return new uint8_t[size];
+  }
+
+  capacity = size_t(1) << shift;
+  {
+    std::lock_guard lock(mutex);
+    auto &blocks = freeBlocks[shift - minSizeClassShift];
+
+    if (!blocks.empty()) {
+      uint8_t *block = blocks.back();
+      blocks.pop_back();
+      pooledBytes -= capacity;
+      hits.fetch_add(1, std::memory_order_relaxed);
+      return block;
+    }
+  }
+  misses.fetch_add(1, std::memory_order_relaxed);
+  return new uint8_t[capacity];
+}
+
+void MemoryBufferPool::release(uint8_t *block, size_t capacity) noexcept {
+  // Only blocks of the size classes can be reused, i.e. powers of two within the limits.
+  if (std::has_single_bit(capacity)) {
+    size_t shift = std::bit_width(capacity) - 1;
+
+    if (shift >= minSizeClassShift && shift <= maxSizeClassShift) {
+      std::lock_guard lock(mutex);
+
+      if (pooledBytes + capacity <= maxPooledBytes) {
+        try {
+          freeBlocks[shift - minSizeClassShift].push_back(block);
+          pooledBytes += capacity;
+          return;
+        } catch (...) {
+          // Couldn't grow the list of free blocks, so just free the block.
+        }
+      }
+    }
+  }
+  delete[] block;
+}
+
+void MemoryBufferPool::trim() noexcept {
+  std::lock_guard lock(mutex);
+
+  for (auto &blocks : freeBlocks) {
+    for (uint8_t *block : blocks) {
+      delete[] block;
+    }
+    blocks.clear();
+  }
+  pooledBytes = 0;
+}
+
+MemoryBufferPool::Stats MemoryBufferPool::getStats() const noexcept {
+  std::lock_guard lock(mutex);
+  return {
+    .hits = hits.load(std::memory_order_relaxed),
+    .misses = misses.load(std::memory_order_relaxed),
+    .pooledBytes = pooledBytes
+  };
+}
+
 }
@@ -2,7 +2,12 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
 #include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
 #include <jsi/jsi.h>
 
 namespace jsi = facebook::jsi;
@@ -21,6 +26,12 @@ public:
   MemoryBuffer(uint8_t* data, size_t size, CleanupFunc&& cleanupFunc);
   ~MemoryBuffer() override;
 
+  /**
+   * Creates a buffer of the given size with uninitialized memory taken from the shared `MemoryBufferPool`.
+   * The memory goes back to the pool when the buffer is deallocated, e.g. when the JS ArrayBuffer is collected.
+   */
+  static std::shared_ptr<MemoryBuffer> allocate(size_t size);
+
   uint8_t* data() override;
   [[nodiscard]] size_t size() const override;
 
@@ -30,6 +41,73 @@ private:
   CleanupFunc cleanupFunc;
 };
 
+/**
+ * A thread-safe pool of memory blocks grouped into power-of-two size classes, from 4 KiB to 4 MiB.
+ * Blocks of released buffers are kept for reuse, so repeatedly allocating buffers of similar sizes
+ * doesn't hit the system allocator. Larger blocks are not pooled. On Android, it backs the pooled `ArrayBuffer`s
+ * and `NativeArrayBuffer`s, and the ArrayBuffers that native code creates for JavaScript.
+ */
+class MemoryBufferPool {
+public:
+  struct Stats {
+    /**
+     Number of allocations served with a pooled block.
+     */
+    size_t hits;
+
+    /**
+     Number of allocations that needed a new block.
+     */
+    size_t misses;
+
+    /**
+     Total size of the blocks currently kept in the pool.
+     */
+    size_t pooledBytes;
+  };
+
+  /**
+   * Returns the pool shared by all `MemoryBuffer`s.
+   */
+  static MemoryBufferPool &shared();
+
+  ~MemoryBufferPool();
+
+  /**
+   * Returns a block of at least `size` bytes and sets `capacity` to its actual size.
+   */
+  uint8_t *acquire(size_t size, size_t &capacity);
+
+  /**
+   * Gives back the block previously returned by `acquire` with the given capacity.
+   */
+  void release(uint8_t *block, size_t capacity) noexcept;
+
+  /**
+   * Frees all blocks kept in the pool.
+   */
+  void trim() noexcept;
+
+  [[nodiscard]] Stats getStats() const noexcept;
+
+private:
+  static constexpr size_t minSizeClassShift = 12; // 4 KiB
+  static constexpr size_t maxSizeClassShift = 22; // 4 MiB
+  static constexpr size_t sizeClassesCount = maxSizeClassShift - minSizeClassShift + 1;
+
+  /**
+   * Maximum total size of the blocks kept in the pool.
+   */
+  static constexpr size_t maxPooledBytes = 16 * 1024 * 1024;
+
+  mutable std::mutex mutex;
+  std::array<std::vector<uint8_t *>, sizeClassesCount> freeBlocks;
+  size_t pooledBytes = 0;
+
+  std::atomic<size_t> hits{0};
+  std::atomic<size_t> misses{0};
+};
+
 }
 
 #endif
@@ -8,6 +8,9 @@
 
 #include <jsi/jsi.h>
 
+#include <deque>
+#include <mutex>
+
 namespace jsi = facebook::jsi;
 namespace react = facebook::react;
 
@@ -16,13 +19,37 @@ namespace expo {
 /**
  * Dummy CallInvoker that invokes everything immediately on the calling thread.
  * Used in the test environment to check the async flow.
+ * Like on the real JS thread, a task never runs inside another one - tasks scheduled while a task is running
+ * are run right after it, in the order they were scheduled.
  */
 class TestingSyncJSCallInvoker : public react::CallInvoker {
 public:
   explicit TestingSyncJSCallInvoker(const std::shared_ptr<jsi::Runtime>& runtime) : runtime(runtime) {}
 
   void invokeAsync(react::CallFunc &&func) noexcept override {
-    func(*runtime.lock());
+    {
+      std::lock_guard lock(mutex);
+      pendingTasks.push_back(std::move(func));
+
+      if (isRunning) {
+        return;
+      }
+      isRunning = true;
+    }
+
+    while (true) {
+      react::CallFunc task;
+      {
+        std::lock_guard lock(mutex);
+        if (pendingTasks.empty()) {
+          isRunning = false;
+          return;
+        }
+        task = std::move(pendingTasks.front());
+        pendingTasks.pop_front();
+      }
+      task(*runtime.lock());
+    }
   }
 
   void invokeSync(react::CallFunc &&func) override {
@@ -32,6 +59,11 @@ public:
   ~TestingSyncJSCallInvoker() override = default;
 
   std::weak_ptr<jsi::Runtime> runtime;
+
+private:
+  std::mutex mutex;
+  std::deque<react::CallFunc> pendingTasks;
+  bool isRunning = false;
 };
 
 } // namespace expo
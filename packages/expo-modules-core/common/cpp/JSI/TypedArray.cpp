@@ -1,10 +1,94 @@
 // Copyright 2022-present 650 Industries. All rights reserved.
 
+#include <array>
+#include <stdexcept>
 #include <unordered_map>
 #include "TypedArray.h"
+#include "JSIUtils.h"
 
 namespace expo {
 
+namespace {
+
+/**
+ * Per-runtime cache of the typed array constructors, so the kind of a typed array
+ * can be determined by comparing its constructor rather than looking up its name.
+ */
+struct TypedArrayCache {
+  static constexpr jsi::UUID uuid{0x271037b5, 0x5ec7, 0x4c2b, 0x8623, 0x6b6bba4cba5b};
+
+  struct Constructor {
+    jsi::Object object;
+    TypedArrayKind kind;
+  };
+
+  jsi::PropNameID constructorPropName;
+  jsi::Object arrayBufferClass;
+  jsi::Function isView;
+  std::vector<Constructor> constructors;
+
+  explicit TypedArrayCache(jsi::Runtime &runtime)
+    : constructorPropName(jsi::PropNameID::forAscii(runtime, "constructor")),
+      arrayBufferClass(runtime.global().getPropertyAsObject(runtime, "ArrayBuffer")),
+      isView(arrayBufferClass.getPropertyAsFunction(runtime, "isView")) {
+    static const std::array<std::pair<const char *, TypedArrayKind>, 11> kinds = {{
+      // The most common kinds go first as they are checked in order.
+      {"Uint8Array", TypedArrayKind::Uint8Array},
+      {"Float32Array", TypedArrayKind::Float32Array},
+      {"Int32Array", TypedArrayKind::Int32Array},
+      {"Uint32Array", TypedArrayKind::Uint32Array},
+      {"Float64Array", TypedArrayKind::Float64Array},
+      {"Int8Array", TypedArrayKind::Int8Array},
+      {"Int16Array", TypedArrayKind::Int16Array},
+      {"Uint16Array", TypedArrayKind::Uint16Array},
+      {"Uint8ClampedArray", TypedArrayKind::Uint8ClampedArray},
+      {"BigInt64Array", TypedArrayKind::BigInt64Array},
+      {"BigUint64Array", TypedArrayKind::BigUint64Array},
+    }};
+    jsi::Object global = runtime.global();
+    constructors.reserve(kinds.size());
+
+    for (const auto &[name, kind] : kinds) {
+      // Some engines may not provide all of the kinds (e.g. the BigInt ones).
+      jsi::Value constructor = global.getProperty(runtime, name);
+      if (constructor.isObject()) {
+        constructors.push_back({constructor.getObject(runtime), kind});
+      }
+    }
+  }
+
+  bool isArrayBufferView(jsi::Runtime &runtime, const jsi::Object &object) const {
+    return isView.callWithThis(runtime, arrayBufferClass, {jsi::Value(runtime, object)}).getBool();
+  }
+
+  /**
+   * Returns the kind of the given object when it's a typed array. The object is confirmed to be an ArrayBuffer view first,
+   * so plain objects pretending to be typed arrays (e.g. with their `constructor` property overridden) are not accepted.
+   * The constructor is then only used to pick the kind.
+   */
+  std::optional<TypedArrayKind> kindOf(jsi::Runtime &runtime, const jsi::Object &object) const {
+    // ArrayBuffers are recognized natively, without calling `ArrayBuffer.isView`.
+    if (object.isArrayBuffer(runtime) || !isArrayBufferView(runtime, object)) {
+      return std::nullopt;
+    }
+
+    jsi::Value constructor = object.getProperty(runtime, constructorPropName);
+    if (!constructor.isObject()) {
+      return std::nullopt;
+    }
+    jsi::Object constructorObject = constructor.getObject(runtime);
+
+    for (const auto &entry : constructors) {
+      if (jsi::Object::strictEquals(runtime, entry.object, constructorObject)) {
+        return entry.kind;
+      }
+    }
+    return std::nullopt;
+  }
+};
+
+} // namespace
+
 std::unordered_map<std::string, TypedArrayKind> nameToKindMap = {
     {"Int8Array", TypedArrayKind::Int8Array},
     {"Int16Array", TypedArrayKind::Int16Array},
@@ -23,10 +107,26 @@ TypedArrayKind getTypedArrayKindForName(const std::string &name) {
   return nameToKindMap.at(name);
 }
 
+TypedArrayView::TypedArrayView(jsi::Runtime &runtime, jsi::ArrayBuffer buffer, size_t byteOffset, size_t byteLength)
+    : buffer(std::move(buffer)), offset(byteOffset), length(byteLength) {
+  if (offset + length > this->buffer.size(runtime)) {
+    throw std::out_of_range("The view exceeds the bounds of the ArrayBuffer");
+  }
+  bufferData = this->buffer.data(runtime);
+}
+
+std::vector<uint8_t> TypedArrayView::copy() const {
+  return {data(), data() + length};
+}
+
 TypedArray::TypedArray(jsi::Runtime &runtime, const jsi::Object &obj)
     : jsi::Object(jsi::Value(runtime, obj).asObject(runtime)) {}
 
 TypedArrayKind TypedArray::getKind(jsi::Runtime &runtime) const {
+  if (auto kind = common::getRuntimeCache<TypedArrayCache>(runtime).kindOf(runtime, *this)) {
+    return *kind;
+  }
+  // Fall back to the constructor name, e.g. for typed arrays created in a different realm.
   auto constructorName = this->getPropertyAsObject(runtime, "constructor")
                              .getProperty(runtime, "name")
                              .asString(runtime)
@@ -51,6 +151,10 @@ jsi::ArrayBuffer TypedArray::getBuffer(jsi::Runtime &runtime) const {
   }
 }
 
+TypedArrayView TypedArray::getView(jsi::Runtime &runtime) const {
+  return {runtime, getBuffer(runtime), byteOffset(runtime), byteLength(runtime)};
+}
+
 jsi::ArrayBuffer TypedArray::getViewedBufferSlice(jsi::Runtime &runtime) const {
   auto buffer = getBuffer(runtime);
 
@@ -77,15 +181,24 @@ void* TypedArray::getRawPointer(jsi::Runtime &runtime) const {
 }
 
 bool isTypedArray(jsi::Runtime &runtime, const jsi::Object &jsObj) {
-  jsi::Object ArrayBuffer = runtime
-    .global()
-    .getPropertyAsObject(runtime, "ArrayBuffer");
+  return common::getRuntimeCache<TypedArrayCache>(runtime).isArrayBufferView(runtime, jsObj);
+}
 
-  jsi::Value isViewResult = ArrayBuffer
-    .getPropertyAsFunction(runtime, "isView")
-    .callWithThis(runtime, ArrayBuffer, {jsi::Value(runtime, jsObj)});
+std::optional<TypedArrayKind> getTypedArrayKind(jsi::Runtime &runtime, const jsi::Object &jsObj) {
+  return common::getRuntimeCache<TypedArrayCache>(runtime).kindOf(runtime, jsObj);
+}
 
-  return isViewResult.getBool();
+std::vector<std::optional<TypedArrayKind>> getTypedArrayKinds(jsi::Runtime &runtime, const jsi::Value *values, size_t count) {
+  // The cache is looked up once for the whole list.
+  TypedArrayCache &cache = common::getRuntimeCache<TypedArrayCache>(runtime);
+  std::vector<std::optional<TypedArrayKind>> kinds(count);
+
+  for (size_t i = 0; i < count; i++) {
+    if (values[i].isObject()) {
+      kinds[i] = cache.kindOf(runtime, values[i].getObject(runtime));
+    }
+  }
+  return kinds;
 }
 
 } // namespace expo
@@ -4,6 +4,10 @@
 
 #pragma once
 
+#include <optional>
+#include <span>
+#include <vector>
+
 #include <jsi/jsi.h>
 
 namespace jsi = facebook::jsi;
@@ -26,6 +30,59 @@ enum class TypedArrayKind {
   BigUint64Array = 11,
 };
 
+/**
+ * A borrowed view into the bytes spanned by a typed array, without copying them.
+ * The view holds a reference to the backing ArrayBuffer, so the bytes stay alive for as long as the view does.
+ * It can only be used on the JS thread and must not outlive the runtime. It also becomes invalid
+ * when the buffer is detached (e.g. transferred), so don't keep it across calls into JS.
+ */
+class TypedArrayView {
+ public:
+  TypedArrayView(jsi::Runtime &runtime, jsi::ArrayBuffer buffer, size_t byteOffset, size_t byteLength);
+  TypedArrayView(TypedArrayView &&) noexcept = default;
+  TypedArrayView &operator=(TypedArrayView &&) noexcept = default;
+
+  TypedArrayView(const TypedArrayView &) = delete;
+  TypedArrayView &operator=(const TypedArrayView &) = delete;
+
+  /**
+   * Returns a pointer to the first byte of the view (not the backing buffer).
+   */
+  uint8_t *data() const noexcept {
+    return bufferData + offset;
+  }
+
+  size_t byteOffset() const noexcept {
+    return offset;
+  }
+
+  size_t byteLength() const noexcept {
+    return length;
+  }
+
+  std::span<uint8_t> bytes() const noexcept {
+    return {data(), length};
+  }
+
+  /**
+   * Returns the full backing buffer.
+   */
+  const jsi::ArrayBuffer &getBuffer() const noexcept {
+    return buffer;
+  }
+
+  /**
+   * Copies the viewed bytes to the memory owned by the caller.
+   */
+  std::vector<uint8_t> copy() const;
+
+ private:
+  jsi::ArrayBuffer buffer;
+  uint8_t *bufferData;
+  size_t offset;
+  size_t length;
+};
+
 class TypedArray : public jsi::Object {
  public:
   TypedArray(jsi::Runtime &, const jsi::Object &);
@@ -44,6 +101,12 @@ class TypedArray : public jsi::Object {
    */
   jsi::ArrayBuffer getBuffer(jsi::Runtime &runtime) const;
 
+  /**
+   * Returns a borrowed view of the bytes spanned by this typed array (zero-copy).
+   * Prefer it over `getViewedBufferSlice` when the bytes are only read or written by native code.
+   */
+  TypedArrayView getView(jsi::Runtime &runtime) const;
+
   /**
    * Returns only the portion of the backing buffer spanned by this typed array's view.
    * If the view covers the entire buffer, returns the buffer directly (zero-copy).
@@ -57,6 +120,18 @@ class TypedArray : public jsi::Object {
 
 bool isTypedArray(jsi::Runtime &runtime, const jsi::Object &jsObj);
 
+/**
+ * Returns the kind of the given object when it is a typed array, or `std::nullopt` otherwise.
+ * The object must be an ArrayBuffer view, its constructor is compared by identity with the typed array constructors cached for the runtime.
+ */
+std::optional<TypedArrayKind> getTypedArrayKind(jsi::Runtime &runtime, const jsi::Object &jsObj);
+
+/**
+ * Classifies the whole list of values at once, e.g. the arguments of a function call.
+ * Elements that are not typed arrays are set to `std::nullopt`, as well as views of other kinds like `DataView`.
+ */
+std::vector<std::optional<TypedArrayKind>> getTypedArrayKinds(jsi::Runtime &runtime, const jsi::Value *values, size_t count);
+
 } // namespace expo
 
 #endif // __cplusplus
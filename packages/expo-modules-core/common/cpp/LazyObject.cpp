@@ -5,7 +5,13 @@
 
 namespace expo {
 
-LazyObject::LazyObject(LazyObjectInitializer initializer) : initializer(std::move(initializer)) {}
+LazyObject::LazyObject(
+  LazyObjectInitializer initializer,
+  LazyObjectPropertyInitializer propertyInitializer,
+  LazyObjectPropertyNamesGetter propertyNamesGetter
+) : initializer(std::move(initializer)),
+    propertyInitializer(std::move(propertyInitializer)),
+    propertyNamesGetter(std::move(propertyNamesGetter)) {}
 
 LazyObject::~LazyObject() {
   backedObject = nullptr;
@@ -19,7 +25,16 @@ jsi::Value LazyObject::get(jsi::Runtime &runtime, const jsi::PropNameID &name) {
     }
     initializeBackedObject(runtime);
   }
-  return backedObject ? backedObject->getProperty(runtime, name) : jsi::Value::undefined();
+  if (!backedObject) {
+    return jsi::Value::undefined();
+  }
+  jsi::Value value = backedObject->getProperty(runtime, name);
+
+  // Pending properties are never found on the backed object, so only missing ones need to be looked up.
+  if (value.isUndefined() && !arePropertiesInitialized && initializeProperty(runtime, name)) {
+    return backedObject->getProperty(runtime, name);
+  }
+  return value;
 }
 
 void LazyObject::set(jsi::Runtime &runtime, const jsi::PropNameID &name, const jsi::Value &value) {
@@ -27,6 +42,10 @@ void LazyObject::set(jsi::Runtime &runtime, const jsi::PropNameID &name, const j
     initializeBackedObject(runtime);
   }
   if (backedObject) {
+    if (!arePropertiesInitialized) {
+      // Initialize the property first, so it won't override the value being set.
+      initializeProperty(runtime, name);
+    }
     backedObject->setProperty(runtime, name, value);
   }
 }
@@ -36,12 +55,65 @@ std::vector<jsi::PropNameID> LazyObject::getPropertyNames(jsi::Runtime &runtime)
     initializeBackedObject(runtime);
   }
   if (backedObject) {
+    if (!arePropertiesInitialized) {
+      initializeAllProperties(runtime);
+    }
     jsi::Array propertyNames = backedObject->getPropertyNames(runtime);
     return common::jsiArrayToPropNameIdsVector(runtime, propertyNames);
   }
   return {};
 }
 
+void LazyObject::initializeBackedObject(jsi::Runtime &runtime) {
+  backedObject = initializer(runtime);
+  arePropertiesInitialized = !backedObject || !propertyInitializer;
+  if (arePropertiesInitialized) {
+    return;
+  }
+
+  if (!propertyNamesGetter) {
+    // Names of the properties are unknown, so all of them need to be defined up front.
+    initializeAllProperties(runtime);
+    return;
+  }
+
+  std::vector<std::string> names = propertyNamesGetter();
+  std::vector<std::string> inheritedNames;
+  pendingProperties.reserve(names.size());
+  for (auto &name : names) {
+    // Names that are already reachable, e.g. through the prototype, have to be defined right away,
+    // so the accessed names can be looked up only when the backed object doesn't have them.
+    if (backedObject->hasProperty(runtime, name.c_str())) {
+      inheritedNames.push_back(std::move(name));
+    } else {
+      pendingProperties.insert(std::move(name));
+    }
+  }
+  arePropertiesInitialized = pendingProperties.empty();
+
+  for (const auto &name : inheritedNames) {
+    propertyInitializer(runtime, *backedObject, name);
+  }
+}
+
+bool LazyObject::initializeProperty(jsi::Runtime &runtime, const jsi::PropNameID &name) {
+  auto node = pendingProperties.extract(name.utf8(runtime));
+  if (node.empty()) {
+    return false;
+  }
+
+  // Stop looking up the accessed names once every property is defined.
+  arePropertiesInitialized = pendingProperties.empty();
+  propertyInitializer(runtime, *backedObject, node.value());
+  return true;
+}
+
+void LazyObject::initializeAllProperties(jsi::Runtime &runtime) {
+  pendingProperties.clear();
+  arePropertiesInitialized = true;
+  propertyInitializer(runtime, *backedObject, std::nullopt);
+}
+
 const jsi::Object &LazyObject::unwrapObjectIfNecessary(jsi::Runtime &runtime, const jsi::Object &object) {
   if (object.isHostObject<LazyObject>(runtime)) {
     LazyObject::Shared lazyObject = object.getHostObject<LazyObject>(runtime);
@@ -4,6 +4,11 @@
 
 #ifdef __cplusplus
 
+#include <optional>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
 #include <jsi/jsi.h>
 
 namespace jsi = facebook::jsi;
@@ -15,14 +20,30 @@ namespace expo {
  */
 typedef std::function<std::shared_ptr<jsi::Object>(jsi::Runtime &)> LazyObjectInitializer;
 
+/**
+ A function that is responsible for defining a single property on the backed object, right before it's accessed for the first time.
+ When the name is `std::nullopt`, it should define all remaining properties, e.g. before the property names are enumerated.
+ */
+typedef std::function<void(jsi::Runtime &, jsi::Object &, const std::optional<std::string> &)> LazyObjectPropertyInitializer;
+
+/**
+ A function that returns names of the properties defined by the property initializer. It's called once, right after the backed object is initialized.
+ */
+typedef std::function<std::vector<std::string>()> LazyObjectPropertyNamesGetter;
+
 /**
  A host object that defers the creation of the raw object until any property is accessed for the first time.
+ With the property initializer, the properties of the raw object are also defined one by one, as they're accessed.
  */
 class JSI_EXPORT LazyObject : public jsi::HostObject {
 public:
   using Shared = std::shared_ptr<LazyObject>;
 
-  explicit LazyObject(LazyObjectInitializer initializer);
+  explicit LazyObject(
+    LazyObjectInitializer initializer,
+    LazyObjectPropertyInitializer propertyInitializer = nullptr,
+    LazyObjectPropertyNamesGetter propertyNamesGetter = nullptr
+  );
 
   ~LazyObject() override;
 
@@ -35,19 +56,42 @@ public:
   /**
    If the given object is a host object of type `LazyObject`, it returns its backed object.
    Otherwise, the given object is returned back.
+   Note that the properties of the backed object may not be initialized yet.
    */
   static const jsi::Object &unwrapObjectIfNecessary(jsi::Runtime &runtime, const jsi::Object &object);
 
 private:
   const LazyObjectInitializer initializer;
+  const LazyObjectPropertyInitializer propertyInitializer;
+  const LazyObjectPropertyNamesGetter propertyNamesGetter;
   std::shared_ptr<jsi::Object> backedObject;
 
+  /**
+   Names of the properties that weren't passed to the property initializer yet. None of them can be found on the backed
+   object or its prototypes, so reading a property that is already defined never needs to look this set up.
+   */
+  std::unordered_set<std::string> pendingProperties;
+
+  /**
+   Whether all properties have been initialized, so the property initializer doesn't need to be called anymore.
+   */
+  bool arePropertiesInitialized = false;
+
   /**
    Initializes the backed object. It shouldn't be invoked more than once, so first make sure that `backedObject` is a null pointer.
    */
-  inline void initializeBackedObject(jsi::Runtime &runtime) {
-    backedObject = initializer(runtime);
-  }
+  void initializeBackedObject(jsi::Runtime &runtime);
+
+  /**
+   Initializes the property with the given name if it's one of the pending properties and returns whether it was pending.
+   Requires the backed object to be already initialized.
+   */
+  bool initializeProperty(jsi::Runtime &runtime, const jsi::PropNameID &name);
+
+  /**
+   Initializes all of the pending properties. Requires the backed object to be already initialized.
+   */
+  void initializeAllProperties(jsi::Runtime &runtime);
 
 }; // class LazyObject
 
@@ -2,6 +2,7 @@
 
 #include "JSIUtils.h"
 #include "SharedObject.h"
+#include "SharedObjectRegistry.h"
 
 namespace expo::SharedObject {
 
@@ -15,8 +16,18 @@ NativeState::NativeState(ObjectId objectId,
   objectId(objectId),
   releaser(std::move(releaser)) {}
 
+NativeState::NativeState(ObjectId objectId, std::shared_ptr<Registry> registry)
+: EventEmitter::NativeState(),
+  objectId(objectId),
+  registry(std::move(registry)) {}
+
 NativeState::~NativeState() {
-  releaser(objectId);
+  if (registry) {
+    // Does nothing if the object has already been released with `release()`.
+    registry->releaseCollected(objectId);
+  } else {
+    releaser(objectId);
+  }
 }
 
 #pragma mark - Utils
@@ -36,7 +47,11 @@ void installBaseClass(jsi::Runtime &runtime, const ObjectReleaser& releaser) {
       if (thisObject.hasNativeState<NativeState>(runtime)) {
         auto nativeState = thisObject.getNativeState<NativeState>(runtime);
 
-        releaser(nativeState->objectId);
+        if (nativeState->registry) {
+          nativeState->registry->release(nativeState->objectId);
+        } else {
+          releaser(nativeState->objectId);
+        }
 
         // Should we reset the native state?
         thisObject.setNativeState(runtime, nullptr);
@@ -24,6 +24,8 @@ typedef long ObjectId;
  */
 typedef std::function<void(const ObjectId)> ObjectReleaser;
 
+class Registry;
+
 /**
  Installs a base JavaScript class for all shared objects with a shared release block.
  */
@@ -47,6 +49,11 @@ public:
   const ObjectId objectId = 0;
   const ObjectReleaser releaser;
 
+  /**
+   The registry that assigned the ID, if any. When set, the object is released through the registry instead of the `releaser`.
+   */
+  const std::shared_ptr<Registry> registry;
+
   /**
    Initializes a native state for the shared object with the given ID. The `context`
    and `contextDeallocator` are forwarded to the base so the JS-side `getNativeState`
@@ -58,6 +65,11 @@ public:
               void *context = nullptr,
               void (*contextDeallocator)(void *) = nullptr);
 
+  /**
+   Initializes a native state for the shared object registered in the given registry.
+   */
+  NativeState(ObjectId objectId, std::shared_ptr<Registry> registry);
+
   ~NativeState() override;
 }; // class NativeState
 
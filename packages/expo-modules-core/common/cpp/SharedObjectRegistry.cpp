@@ -0,0 +1,163 @@
+// Copyright 2026-present 650 Industries. All rights reserved.
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "SharedObjectRegistry.h"
+
+namespace expo::SharedObject {
+
+namespace {
+
+// The ID consists of the generation in the upper bits and the slot index incremented by one in the lower bits,
+// so that the IDs are always positive 32-bit integers and zero remains an invalid ID.
+// The IDs stay 32-bit, as that's what the JS property and Kotlin `SharedObjectId` hold. Slots retire once
+// their generations run out, so all slots together can issue about as many IDs as a plain 31-bit counter.
+constexpr uint32_t indexBits = 22;
+constexpr uint32_t indexMask = (1u << indexBits) - 1;
+constexpr uint32_t generationMask = (1u << (31 - indexBits)) - 1;
+constexpr uint32_t maxSlots = indexMask - 1;
+constexpr uint32_t noSlot = UINT32_MAX;
+
+inline ObjectId makeObjectId(uint32_t index, uint32_t generation) {
+  return static_cast<ObjectId>((generation << indexBits) | (index + 1));
+}
+
+inline uint32_t indexFromObjectId(ObjectId objectId) {
+  return (static_cast<uint32_t>(objectId) & indexMask) - 1;
+}
+
+inline uint32_t generationFromObjectId(ObjectId objectId) {
+  return static_cast<uint32_t>(objectId) >> indexBits;
+}
+
+} // namespace
+
+Registry::Registry(ObjectReleaser releaser, ObjectReleaser collectedReleaser)
+  : releaser(std::move(releaser)), collectedReleaser(std::move(collectedReleaser)), freeHead(noSlot), freeTail(noSlot) {}
+
+std::shared_ptr<NativeState> Registry::createNativeState() {
+  std::lock_guard lock(mutex);
+  uint32_t index;
+
+  if (freeHead != noSlot) {
+    index = freeHead;
+    freeHead = slots[index].nextFree;
+    if (freeHead == noSlot) {
+      freeTail = noSlot;
+    }
+  } else {
+    if (slots.size() >= maxSlots) {
+      throw std::length_error("Exceeded the maximum number of shared objects");
+    }
+    index = static_cast<uint32_t>(slots.size());
+    slots.emplace_back();
+  }
+
+  Slot &slot = slots[index];
+  auto nativeState = std::make_shared<NativeState>(makeObjectId(index, slot.generation), shared_from_this());
+
+  slot.nativeState = nativeState;
+  slot.isUsed = true;
+
+  liveCount++;
+  peakCount = std::max(peakCount, liveCount);
+
+  return nativeState;
+}
+
+std::shared_ptr<NativeState> Registry::getNativeState(ObjectId objectId) const {
+  std::lock_guard lock(mutex);
+
+  if (auto index = findSlot(objectId)) {
+    return slots[*index].nativeState.lock();
+  }
+  return nullptr;
+}
+
+bool Registry::release(ObjectId objectId) {
+  if (!freeSlot(objectId)) {
+    return false;
+  }
+  // Call the releaser outside of the lock, as it may call back into the registry.
+  releaser(objectId);
+  return true;
+}
+
+void Registry::releaseCollected(ObjectId objectId) {
+  if (!freeSlot(objectId)) {
+    return;
+  }
+  if (collectedReleaser) {
+    collectedReleaser(objectId);
+  } else {
+    releaser(objectId);
+  }
+}
+
+bool Registry::freeSlot(ObjectId objectId) {
+  std::lock_guard lock(mutex);
+  auto index = findSlot(objectId);
+
+  if (!index) {
+    return false;
+  }
+
+  Slot &slot = slots[*index];
+  slot.isUsed = false;
+  slot.nativeState.reset();
+  slot.nextFree = noSlot;
+  liveCount--;
+
+  if (slot.generation == generationMask) {
+    // The generation would wrap around and the slot would reissue the IDs it has already used,
+    // e.g. an ID whose release is still queued. Retire the slot instead, so an ID is never assigned twice.
+    return true;
+  }
+  slot.generation++;
+
+  if (freeTail != noSlot) {
+    slots[freeTail].nextFree = *index;
+  } else {
+    freeHead = *index;
+  }
+  freeTail = *index;
+  return true;
+}
+
+bool Registry::wasReleased(ObjectId objectId) const {
+  std::lock_guard lock(mutex);
+
+  if (objectId <= 0 || indexFromObjectId(objectId) >= slots.size()) {
+    return false;
+  }
+  return !findSlot(objectId);
+}
+
+Registry::Stats Registry::getStats() const {
+  std::lock_guard lock(mutex);
+  return {
+    .live = liveCount,
+    .peak = peakCount,
+    .capacity = slots.size()
+  };
+}
+
+std::optional<uint32_t> Registry::findSlot(ObjectId objectId) const {
+  if (objectId <= 0) {
+    return std::nullopt;
+  }
+  uint32_t index = indexFromObjectId(objectId);
+
+  if (index >= slots.size()) {
+    return std::nullopt;
+  }
+  const Slot &slot = slots[index];
+
+  if (!slot.isUsed || slot.generation != generationFromObjectId(objectId)) {
+    return std::nullopt;
+  }
+  return index;
+}
+
+} // namespace expo::SharedObject
@@ -0,0 +1,117 @@
+// Copyright 2026-present 650 Industries. All rights reserved.
+
+#pragma once
+
+#ifdef __cplusplus
+
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+#include "SharedObject.h"
+
+namespace expo::SharedObject {
+
+/**
+ A registry of the shared objects living in a single runtime, responsible for assigning their IDs.
+ Objects are kept in a slab of slots that are reused once the object is released, so registering
+ and looking up an object takes constant time and, apart from growing the slab, doesn't allocate.
+ The ID consists of the slot index and its generation, which is bumped on each release,
+ so the IDs of released objects are not resolved to the objects that reused their slots.
+ A slot whose generation is exhausted is retired rather than reused, so no ID is ever assigned twice,
+ even when the release of the previous object with that ID is still queued.
+ */
+class JSI_EXPORT Registry : public std::enable_shared_from_this<Registry> {
+public:
+  struct Stats {
+    /**
+     Number of currently registered objects.
+     */
+    size_t live;
+
+    /**
+     The highest number of objects registered at the same time.
+     */
+    size_t peak;
+
+    /**
+     Number of allocated slots, including the retired ones.
+     */
+    size_t capacity;
+  };
+
+  /**
+   Creates the registry with the releasers, one of which is called exactly once for every released object.
+   The `releaser` is called synchronously when the object is released explicitly with `release`.
+   The `collectedReleaser`, if given, is called instead when the object is released because its native state
+   was deallocated, e.g. by the garbage collector. It may be called on any thread, so it usually defers the work.
+   */
+  explicit Registry(ObjectReleaser releaser, ObjectReleaser collectedReleaser = nullptr);
+
+  /**
+   Registers a new object and returns its native state, which needs to be attached to the JS object.
+   The object is released when the native state is deallocated or `release` is called.
+   */
+  std::shared_ptr<NativeState> createNativeState();
+
+  /**
+   Returns the native state of the object with the given ID or `nullptr` if the object is not registered.
+   */
+  std::shared_ptr<NativeState> getNativeState(ObjectId objectId) const;
+
+  /**
+   Releases the object with the given ID. Returns `false` if the object was already released or never registered.
+   */
+  bool release(ObjectId objectId);
+
+  /**
+   Releases the object whose native state was deallocated. Does nothing if it was already released explicitly.
+   */
+  void releaseCollected(ObjectId objectId);
+
+  /**
+   Returns whether the given ID belonged to an object that has already been released.
+   */
+  bool wasReleased(ObjectId objectId) const;
+
+  Stats getStats() const;
+
+private:
+  struct Slot {
+    std::weak_ptr<NativeState> nativeState;
+    uint32_t generation = 0;
+    uint32_t nextFree = 0;
+    bool isUsed = false;
+  };
+
+  const ObjectReleaser releaser;
+  const ObjectReleaser collectedReleaser;
+
+  mutable std::mutex mutex;
+  std::vector<Slot> slots;
+
+  /**
+   The queue of free slots, linked through `Slot::nextFree`. Freed slots are appended to the end,
+   so a slot is reused as late as possible, which makes the generations wrap around less often.
+   */
+  uint32_t freeHead;
+  uint32_t freeTail;
+
+  size_t liveCount = 0;
+  size_t peakCount = 0;
+
+  /**
+   Returns the slot index for the given ID if the ID refers to a registered object. Requires the mutex to be locked.
+   */
+  std::optional<uint32_t> findSlot(ObjectId objectId) const;
+
+  /**
+   Frees the slot of the object with the given ID. Returns `false` if the object is not registered.
+   */
+  bool freeSlot(ObjectId objectId);
+}; // class Registry
+
+} // namespace expo::SharedObject
+
+#endif // __cplusplus
@@ -0,0 +1,61 @@
+// Copyright 2026-present 650 Industries. All rights reserved.
+
+#include "SharedObjectReleaseQueue.h"
+
+namespace expo::SharedObject {
+
+ReleaseQueue::ReleaseQueue(BatchReleaser releaser, Scheduler scheduler, size_t initialCapacity)
+  : releaser(std::move(releaser)), scheduler(std::move(scheduler)) {
+  pendingIds.reserve(initialCapacity);
+  flushingIds.reserve(initialCapacity);
+}
+
+ReleaseQueue::~ReleaseQueue() {
+  if (pendingIds.empty()) {
+    return;
+  }
+  scheduler([releaser = releaser, objectIds = std::move(pendingIds)]() {
+    releaser(objectIds);
+  });
+}
+
+void ReleaseQueue::enqueue(ObjectId objectId) {
+  {
+    std::lock_guard lock(mutex);
+    pendingIds.push_back(objectId);
+
+    if (isFlushScheduled) {
+      return;
+    }
+    isFlushScheduled = true;
+  }
+
+  scheduler([weakThis = weak_from_this()]() {
+    if (auto queue = weakThis.lock()) {
+      queue->flush();
+    }
+  });
+}
+
+void ReleaseQueue::flush() {
+  std::lock_guard flushLock(flushMutex);
+  {
+    std::lock_guard lock(mutex);
+    std::swap(pendingIds, flushingIds);
+    isFlushScheduled = false;
+  }
+
+  if (flushingIds.empty()) {
+    return;
+  }
+  try {
+    releaser(flushingIds);
+  } catch (...) {
+    // Don't deliver the same IDs again with the next flush.
+    flushingIds.clear();
+    throw;
+  }
+  flushingIds.clear();
+}
+
+} // namespace expo::SharedObject
@@ -0,0 +1,77 @@
+// Copyright 2026-present 650 Industries. All rights reserved.
+
+#pragma once
+
+#ifdef __cplusplus
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "SharedObject.h"
+
+namespace expo::SharedObject {
+
+/**
+ A queue that collects IDs of released shared objects from any thread and passes them to the releaser in batches.
+ Enqueueing never calls the releaser, as objects are usually released by the garbage collector on a thread
+ that may not be able to run it. Instead, the first enqueued ID schedules a flush with the scheduler,
+ which delivers everything enqueued until the flush runs. The IDs are collected in buffers that keep their capacity
+ between flushes, so enqueueing doesn't allocate once the buffers have grown to the usual batch size.
+ */
+class JSI_EXPORT ReleaseQueue : public std::enable_shared_from_this<ReleaseQueue> {
+public:
+  /**
+   Releases the batch of objects with the given IDs.
+   */
+  using BatchReleaser = std::function<void(const std::vector<ObjectId> &objectIds)>;
+
+  /**
+   Schedules the given task to be run later, on a thread that can call the releaser.
+   */
+  using Scheduler = std::function<void(std::function<void()> &&task)>;
+
+  ReleaseQueue(BatchReleaser releaser, Scheduler scheduler, size_t initialCapacity = 256);
+
+  /**
+   Hands the IDs that are still in the queue over to the scheduler, as the queue may be deallocated on any thread.
+   */
+  ~ReleaseQueue();
+
+  /**
+   Adds the object ID to the queue. Thread-safe.
+   */
+  void enqueue(ObjectId objectId);
+
+  /**
+   Delivers all IDs that are currently in the queue. Must be called on a thread that can call the releaser.
+   */
+  void flush();
+
+private:
+  const BatchReleaser releaser;
+  const Scheduler scheduler;
+
+  std::mutex mutex;
+  bool isFlushScheduled = false;
+
+  /**
+   IDs waiting for the next flush.
+   */
+  std::vector<ObjectId> pendingIds;
+
+  /**
+   Serializes the flushes, which may run on different threads.
+   */
+  std::mutex flushMutex;
+
+  /**
+   IDs that are being delivered. Swapped with `pendingIds`, so both keep their capacity.
+   */
+  std::vector<ObjectId> flushingIds;
+}; // class ReleaseQueue
+
+} // namespace expo::SharedObject
+
+#endif // __cplusplus